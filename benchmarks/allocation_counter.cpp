@@ -0,0 +1,40 @@
+/**
+ * @file benchmarks/allocation_counter.cpp
+ * @brief Definitions for counting the heap allocations in the benchmarks.
+ *
+ * The replacements live in their own translation unit, so that they are never inlined
+ * into the benchmarks and mixed up with the malloc/free calls there.
+ */
+// header include
+#include "allocation_counter.h"
+
+// system includes
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+  std::atomic<std::uint64_t> g_allocation_count {0};
+}  // namespace
+
+void *operator new(const std::size_t size) {
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void *ptr {std::malloc(size == 0 ? 1 : size)}) {
+    return ptr;
+  }
+  throw std::bad_alloc {};
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace display_device::bench {
+  std::uint64_t getAllocationCount() {
+    return g_allocation_count.load(std::memory_order_relaxed);
+  }
+}  // namespace display_device::bench
@@ -0,0 +1,17 @@
+/**
+ * @file benchmarks/allocation_counter.h
+ * @brief Declarations for counting the heap allocations in the benchmarks.
+ */
+#pragma once
+
+// system includes
+#include <cstdint>
+
+namespace display_device::bench {
+  /**
+   * @brief Get the number of the global `operator new` calls made so far.
+   * @returns Number of allocations.
+   * @note Only the binaries that link `allocation_counter.cpp` replace the global `operator new`.
+   */
+  [[nodiscard]] std::uint64_t getAllocationCount();
+}  // namespace display_device::bench
@@ -0,0 +1,59 @@
+// system includes
+#include <benchmark/benchmark.h>
+#include <boost/uuid/name_generator_sha1.hpp>
+#include <boost/uuid/uuid.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include <string>
+#include <vector>
+
+// local includes
+#include "display_device/device_fingerprint.h"
+
+namespace {
+  /**
+   * @brief Input similar to what the Windows layer hashes: EDID with 1 extension + stable instance ID parts.
+   */
+  struct Input {
+    std::vector<std::byte> m_edid;
+    std::wstring m_instance_id;
+  };
+
+  Input makeInput() {
+    Input input {std::vector<std::byte>(256), L"DISPLAY\\ACI27EC\\5&4FD2DE4UID4352"};
+    for (std::size_t i {0}; i < input.m_edid.size(); ++i) {
+      input.m_edid[i] = std::byte {static_cast<std::uint8_t>(i * 31)};
+    }
+    return input;
+  }
+
+  void BM_DeviceFingerprint(benchmark::State &state) {
+    const auto input {makeInput()};
+    for (auto _ : state) {
+      const auto fingerprint {display_device::DeviceFingerprint::create(input.m_edid, std::as_bytes(std::span {input.m_instance_id}))};
+      benchmark::DoNotOptimize(fingerprint.toString());
+    }
+  }
+
+  /**
+   * @brief Mirrors the current Windows device ID generation.
+   */
+  void BM_BoostSha1Uuid(benchmark::State &state) {
+    const auto input {makeInput()};
+    for (auto _ : state) {
+      std::vector<std::byte> data {input.m_edid};
+      data.insert(std::end(data), reinterpret_cast<const std::byte *>(input.m_instance_id.data()), reinterpret_cast<const std::byte *>(input.m_instance_id.data() + input.m_instance_id.size()));
+
+      static constexpr boost::uuids::uuid ns_id {};
+      const auto uuid {boost::uuids::name_generator_sha1 {ns_id}(data.data(), data.size())};
+      std::string device_id;
+      device_id.reserve(38);
+      device_id += "{";
+      device_id += boost::uuids::to_string(uuid);
+      device_id += "}";
+      benchmark::DoNotOptimize(device_id);
+    }
+  }
+}  // namespace
+
+BENCHMARK(BM_DeviceFingerprint);
+BENCHMARK(BM_BoostSha1Uuid);
@@ -0,0 +1,102 @@
+// system includes
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// local includes
+#include "display_device/detail/edid_checksum.h"
+#include "display_device/edid_validation.h"
+
+namespace {
+  constexpr std::size_t BLOCK_SIZE {128};
+  constexpr std::size_t BATCH_SIZE {64};
+
+  /**
+   * @brief Create a batch of valid EDIDs with 1 extension block each.
+   */
+  std::vector<std::vector<std::byte>> makeBatch() {
+    std::vector<std::vector<std::byte>> batch;
+    for (std::size_t i {0}; i < BATCH_SIZE; ++i) {
+      std::vector<std::byte> edid(2 * BLOCK_SIZE);
+      for (std::size_t j {1}; j < 7; ++j) {
+        edid[j] = std::byte {0xFF};
+      }
+      for (std::size_t j {8}; j < edid.size(); ++j) {
+        edid[j] = std::byte {static_cast<std::uint8_t>(i * 31 + j * 7)};
+      }
+      edid[126] = std::byte {0x01};
+
+      for (std::size_t block {0}; block < 2; ++block) {
+        int sum {0};
+        for (std::size_t j {0}; j < BLOCK_SIZE - 1; ++j) {
+          sum += static_cast<int>(edid[block * BLOCK_SIZE + j]);
+        }
+        edid[block * BLOCK_SIZE + BLOCK_SIZE - 1] = std::byte {static_cast<std::uint8_t>((256 - sum % 256) % 256)};
+      }
+      batch.push_back(std::move(edid));
+    }
+    return batch;
+  }
+
+  /**
+   * @brief The byte-at-a-time loop that was used by EdidData::parse for the base block.
+   */
+  bool legacyChecksum(const std::vector<std::byte> &data, const std::size_t block) {
+    int sum = 0;
+    for (std::size_t i = 0; i < BLOCK_SIZE; ++i) {
+      sum += static_cast<int>(data[block * BLOCK_SIZE + i]);
+    }
+    return sum % 256 == 0;
+  }
+
+  void BM_LegacyLoop(benchmark::State &state) {
+    const auto batch {makeBatch()};
+    for (auto _ : state) {
+      for (const auto &edid : batch) {
+        const std::size_t blocks {1 + std::to_integer<std::size_t>(edid[126])};
+        for (std::size_t block {0}; block < blocks; ++block) {
+          benchmark::DoNotOptimize(legacyChecksum(edid, block));
+        }
+      }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * batch.size()));
+  }
+
+  void BM_BlockSumImpl(benchmark::State &state) {
+    const auto impls {display_device::detail::getSupportedEdidBlockSumImpls()};
+    const auto index {static_cast<std::size_t>(state.range(0))};
+    if (index >= impls.size()) {
+      state.SkipWithError("Implementation is not supported by the CPU");
+      return;
+    }
+
+    const auto &impl {impls[index]};
+    state.SetLabel(std::string {impl.m_name});
+
+    const auto batch {makeBatch()};
+    for (auto _ : state) {
+      for (const auto &edid : batch) {
+        const std::size_t blocks {1 + std::to_integer<std::size_t>(edid[126])};
+        for (std::size_t block {0}; block < blocks; ++block) {
+          benchmark::DoNotOptimize(impl.m_function(edid.data() + block * BLOCK_SIZE));
+        }
+      }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * batch.size()));
+  }
+
+  void BM_ValidateEdids(benchmark::State &state) {
+    const auto batch {makeBatch()};
+    const std::vector<std::span<const std::byte>> edids {std::begin(batch), std::end(batch)};
+    std::vector<display_device::EdidValidationResult> results(edids.size());
+
+    for (auto _ : state) {
+      display_device::validateEdids(edids, results);
+      benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * batch.size()));
+  }
+}  // namespace
+
+BENCHMARK(BM_LegacyLoop);
+BENCHMARK(BM_BlockSumImpl)->DenseRange(0, 2);
+BENCHMARK(BM_ValidateEdids);
@@ -0,0 +1,191 @@
+#if !defined(_MSC_VER) && !defined(_POSIX_THREAD_SAFE_FUNCTIONS)
+  #define _POSIX_THREAD_SAFE_FUNCTIONS  // For localtime_r
+#endif
+
+// system includes
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+
+// local includes
+#include "allocation_counter.h"
+#include "display_device/detail/timestamp_formatter.h"
+#include "display_device/logging.h"
+#include "display_device/mapped_file_sink.h"
+
+namespace {
+  /**
+   * @brief Discards everything written to it.
+   */
+  class NullStreamBuffer: public std::streambuf {
+  protected:
+    int_type overflow(const int_type ch) override {
+      return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char *, const std::streamsize size) override {
+      return size;
+    }
+  };
+
+  /**
+   * @brief Redirects std::cout to the null buffer for the lifetime of the object.
+   */
+  class SilencedCout {
+  public:
+    SilencedCout():
+        m_original {std::cout.rdbuf(&m_null_buffer)} {}
+
+    ~SilencedCout() {
+      std::cout.rdbuf(m_original);
+    }
+
+  private:
+    NullStreamBuffer m_null_buffer;
+    std::streambuf *m_original;
+  };
+
+  template<class Function>
+  void runCountingAllocations(benchmark::State &state, Function &&function) {
+    const auto allocations_before {display_device::bench::getAllocationCount()};
+    for (auto _ : state) {
+      function();
+    }
+    const auto allocations {display_device::bench::getAllocationCount() - allocations_before};
+    state.counters["allocs_per_line"] = benchmark::Counter(static_cast<double>(allocations) / static_cast<double>(state.iterations()));
+  }
+
+  /**
+   * @brief A typical single line log statement.
+   */
+  template<class Stream>
+  void writeTypicalLine(Stream &stream) {
+    stream << "Failed to set display mode for " << "DISPLAY\\ACI27EC\\5&4FD2DE4" << ": " << 2560 << "x" << 1440 << " @ " << 143.912 << "Hz, attempt " << 3u;
+  }
+
+  /**
+   * @brief Mirrors the previous LogWriter buffer.
+   */
+  void BM_LogLine_OStringStream(benchmark::State &state) {
+    runCountingAllocations(state, []() {
+      std::ostringstream stream;
+      writeTypicalLine(stream);
+      benchmark::DoNotOptimize(stream.str());
+    });
+  }
+
+  void BM_LogLine_LogBuffer(benchmark::State &state) {
+    runCountingAllocations(state, []() {
+      display_device::detail::LogBuffer buffer;
+      buffer.append("Failed to set display mode for ");
+      buffer.append("DISPLAY\\ACI27EC\\5&4FD2DE4");
+      buffer.append(": ");
+      buffer.appendNumber(2560);
+      buffer.append("x");
+      buffer.appendNumber(1440);
+      buffer.append(" @ ");
+      buffer.appendNumber(143.912);
+      buffer.append("Hz, attempt ");
+      buffer.appendNumber(3u);
+      benchmark::DoNotOptimize(buffer.view());
+    });
+  }
+
+  /**
+   * @brief Full DD_LOG statement to the default (silenced) output.
+   */
+  void BM_LogLine_DdLog(benchmark::State &state) {
+    const SilencedCout silenced_cout;
+    display_device::Logger::get().setLogLevel(display_device::Logger::LogLevel::info);
+    runCountingAllocations(state, []() {
+      DD_LOG(info) << "Failed to set display mode for " << "DISPLAY\\ACI27EC\\5&4FD2DE4" << ": " << 2560 << "x" << 1440 << " @ " << 143.912 << "Hz, attempt " << 3u;
+    });
+  }
+
+  /**
+   * @brief Mirrors the previous Logger::write timestamp formatting.
+   */
+  void BM_Timestamp_PutTime(benchmark::State &state) {
+    for (auto _ : state) {
+      std::stringstream stream;
+      const auto now {std::chrono::system_clock::now()};
+      const auto now_ms {std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch())};
+      const auto now_s {std::chrono::duration_cast<std::chrono::seconds>(now_ms)};
+
+      const std::time_t time {std::chrono::system_clock::to_time_t(now)};
+      std::tm localtime {};
+#if defined(_MSC_VER)
+      localtime_s(&localtime, &time);
+#else
+      localtime_r(&time, &localtime);
+#endif
+      const auto now_decimal_part {now_ms - now_s};
+
+      stream << std::put_time(&localtime, "[%Y-%m-%d %H:%M:%S.") << std::setfill('0') << std::setw(3) << now_decimal_part.count() << "] ";
+      benchmark::DoNotOptimize(stream.str());
+    }
+  }
+
+  /**
+   * @brief Verbose statement below the enabled log level, with and without the flight recorder.
+   */
+  void BM_FlightRecorder(benchmark::State &state) {
+    auto &logger {display_device::Logger::get()};
+    logger.setLogLevel(display_device::Logger::LogLevel::info);
+    if (state.range(0) != 0) {
+      logger.enableFlightRecorder();
+    }
+    runCountingAllocations(state, []() {
+      DD_LOG(verbose) << "Querying the display mode for " << "DISPLAY\\ACI27EC\\5&4FD2DE4" << ", attempt " << 3u;
+    });
+    logger.disableFlightRecorder();
+  }
+
+  /**
+   * @brief Line written to the file via std::ofstream with the std::endl flush.
+   */
+  void BM_FileSink_OfstreamEndl(benchmark::State &state) {
+    const std::filesystem::path filepath {"bench_ofstream.log"};
+    {
+      std::ofstream stream {filepath, std::ios::trunc};
+      display_device::detail::TimestampBuffer buffer;
+      for (auto _ : state) {
+        stream << display_device::detail::formatTimestamp(std::chrono::system_clock::now(), buffer) << "INFO:    Display configuration changed" << std::endl;
+      }
+    }
+    std::filesystem::remove(filepath);
+  }
+
+  void BM_FileSink_Mapped(benchmark::State &state) {
+    const std::filesystem::path filepath {"bench_mapped.log"};
+    {
+      display_device::MappedFileSink sink {filepath, 16 * 1024 * 1024, 0};
+      for (auto _ : state) {
+        sink.write(display_device::Logger::LogLevel::info, "Display configuration changed");
+      }
+    }
+    std::filesystem::remove(filepath);
+  }
+
+  void BM_Timestamp_Cached(benchmark::State &state) {
+    display_device::detail::TimestampBuffer buffer;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(display_device::detail::formatTimestamp(std::chrono::system_clock::now(), buffer));
+    }
+  }
+}  // namespace
+
+BENCHMARK(BM_Timestamp_PutTime);
+BENCHMARK(BM_Timestamp_Cached);
+BENCHMARK(BM_LogLine_OStringStream);
+BENCHMARK(BM_LogLine_LogBuffer);
+BENCHMARK(BM_LogLine_DdLog);
+BENCHMARK(BM_FlightRecorder)->Arg(0)->Arg(1);
+BENCHMARK(BM_FileSink_OfstreamEndl);
+BENCHMARK(BM_FileSink_Mapped);
@@ -0,0 +1,111 @@
+/**
+ * @file src/common/backoff_policy.cpp
+ * @brief Definitions for the retry backoff policies.
+ */
+// header include
+#include "display_device/backoff_policy.h"
+
+// system includes
+#include <algorithm>
+
+namespace display_device {
+  namespace {
+    constexpr std::chrono::milliseconds MIN_DURATION {1};
+
+    template<class... Ts>
+    struct Overloaded: Ts... {
+      using Ts::operator()...;
+    };
+  }  // namespace
+
+  std::chrono::milliseconds ListBackoff::next() {
+    const auto duration {m_durations[m_index]};
+    if (m_index + 1 < m_durations.size()) {
+      ++m_index;
+    }
+    return duration;
+  }
+
+  std::chrono::milliseconds ConstantBackoff::next() const {
+    return m_duration;
+  }
+
+  std::chrono::milliseconds LinearBackoff::next() {
+    const auto attempt {static_cast<std::chrono::milliseconds::rep>(m_attempt)};
+    if (m_step.count() > 0 && attempt > (m_max - m_initial) / m_step) {
+      return m_max;
+    }
+
+    ++m_attempt;
+    return std::min(m_initial + m_step * attempt, m_max);
+  }
+
+  std::chrono::milliseconds ExponentialBackoff::next() {
+    if (m_current <= std::chrono::milliseconds::zero()) {
+      m_current = std::min(m_initial, m_max);
+    } else if (m_current < m_max) {
+      const auto next_value {static_cast<double>(m_current.count()) * m_multiplier};
+      if (next_value >= static_cast<double>(m_max.count())) {
+        m_current = m_max;
+      } else {
+        // The truncation would otherwise keep the small durations from growing with the fractional multipliers (e.g. 1ms * 1.5)
+        const std::chrono::milliseconds truncated {static_cast<std::chrono::milliseconds::rep>(next_value)};
+        m_current = m_multiplier > 1.0 ? std::max(truncated, m_current + MIN_DURATION) : truncated;
+      }
+    }
+    return m_current;
+  }
+
+  std::chrono::milliseconds DecorrelatedJitterBackoff::next() {
+    if (m_previous <= std::chrono::milliseconds::zero()) {
+      // Seeded here instead of the member initializer, so that the copies of the same policy do not retry in lockstep
+      m_engine.seed(std::random_device {}());
+      m_previous = std::min(m_base, m_max);
+      return m_previous;
+    }
+
+    const auto upper_bound {std::max(m_base, m_previous >= m_max / 3 ? m_max : m_previous * 3)};
+    std::uniform_int_distribution<std::chrono::milliseconds::rep> distribution {m_base.count(), upper_bound.count()};
+    m_previous = std::min(std::chrono::milliseconds {distribution(m_engine)}, m_max);
+    return m_previous;
+  }
+
+  std::chrono::milliseconds CustomBackoff::next() {
+    return std::max(m_function(m_attempt++), MIN_DURATION);
+  }
+
+  std::chrono::milliseconds takeNextDuration(BackoffPolicy &policy) {
+    return std::visit([](auto &value) {
+      return value.next();
+    },
+                      policy);
+  }
+
+  bool isValidBackoffPolicy(const BackoffPolicy &policy) {
+    const auto is_positive {[](const std::chrono::milliseconds duration) {
+      return duration > std::chrono::milliseconds::zero();
+    }};
+
+    return std::visit(Overloaded {
+                        [&](const ListBackoff &value) {
+                          return !value.m_durations.empty() && std::ranges::all_of(value.m_durations, is_positive);
+                        },
+                        [&](const ConstantBackoff &value) {
+                          return is_positive(value.m_duration);
+                        },
+                        [&](const LinearBackoff &value) {
+                          return is_positive(value.m_initial) && value.m_step >= std::chrono::milliseconds::zero() && value.m_max >= value.m_initial;
+                        },
+                        [&](const ExponentialBackoff &value) {
+                          return is_positive(value.m_initial) && value.m_multiplier >= 1.0 && value.m_max >= value.m_initial;
+                        },
+                        [&](const DecorrelatedJitterBackoff &value) {
+                          return is_positive(value.m_base) && value.m_max >= value.m_base;
+                        },
+                        [](const CustomBackoff &value) {
+                          return static_cast<bool>(value.m_function);
+                        }
+                      },
+                      policy);
+  }
+}  // namespace display_device
@@ -0,0 +1,76 @@
+/**
+ * @file src/common/device_fingerprint.cpp
+ * @brief Definitions for the stable device fingerprint.
+ */
+// class header include
+#include "display_device/device_fingerprint.h"
+
+// local includes
+#include "display_device/detail/hash.h"
+
+namespace display_device {
+  namespace {
+    // Changing any of these will change all of the fingerprints!
+    constexpr std::uint64_t EDID_SEED {0x6464'6669'6E67'6572ULL};
+    constexpr std::uint64_t UUID_VERSION_MASK {0xFFFF'FFFF'FFFF'0FFFULL};
+    constexpr std::uint64_t UUID_VERSION_8 {0x0000'0000'0000'8000ULL};
+    constexpr std::uint64_t UUID_VARIANT_MASK {0x3FFF'FFFF'FFFF'FFFFULL};
+    constexpr std::uint64_t UUID_VARIANT_RFC {0x8000'0000'0000'0000ULL};
+  }  // namespace
+
+  DeviceFingerprint DeviceFingerprint::create(const std::span<const std::byte> edid, const std::span<const std::byte> connector_id) {
+    // Seeding the second hash with the first one keeps the boundary between the inputs unambiguous
+    // (both hashes also mix in the input length).
+    const auto edid_hash {detail::hashBytes128(edid, EDID_SEED)};
+    const auto hash {detail::hashBytes128(connector_id, edid_hash.m_low)};
+
+    // Marked as the custom (v8) RFC 9562 UUID, so that it can be safely mixed with other UUIDs
+    const std::uint64_t high {((hash.m_high ^ edid_hash.m_high) & UUID_VERSION_MASK) | UUID_VERSION_8};
+    const std::uint64_t low {(hash.m_low & UUID_VARIANT_MASK) | UUID_VARIANT_RFC};
+    return {high, low};
+  }
+
+  DeviceFingerprint DeviceFingerprint::create(const std::span<const std::byte> edid, const std::string_view connector_id) {
+    return create(edid, std::as_bytes(std::span {connector_id}));
+  }
+
+  DeviceFingerprint::DeviceFingerprint(const std::uint64_t high, const std::uint64_t low):
+      m_high {high},
+      m_low {low} {
+  }
+
+  std::array<std::byte, 16> DeviceFingerprint::getBytes() const {
+    std::array<std::byte, 16> bytes {};
+    for (std::size_t i {0}; i < 8; ++i) {
+      bytes[i] = static_cast<std::byte>(m_high >> (56 - i * 8));
+      bytes[i + 8] = static_cast<std::byte>(m_low >> (56 - i * 8));
+    }
+    return bytes;
+  }
+
+  std::string DeviceFingerprint::toString() const {
+    constexpr std::string_view hex_digits {"0123456789abcdef"};
+
+    std::string output;
+    output.reserve(38);
+    output += '{';
+
+    const auto bytes {getBytes()};
+    for (std::size_t i {0}; i < bytes.size(); ++i) {
+      if (i == 4 || i == 6 || i == 8 || i == 10) {
+        output += '-';
+      }
+
+      const auto value {std::to_integer<std::size_t>(bytes[i])};
+      output += hex_digits[value >> 4];
+      output += hex_digits[value & 0x0F];
+    }
+
+    output += '}';
+    return output;
+  }
+
+  bool operator==(const DeviceFingerprint &lhs, const DeviceFingerprint &rhs) {
+    return lhs.m_high == rhs.m_high && lhs.m_low == rhs.m_low;
+  }
+}  // namespace display_device
@@ -0,0 +1,147 @@
+/**
+ * @file src/common/displayid.cpp
+ * @brief Definitions for the zero-copy DisplayID 2.0 decoder.
+ */
+// header include
+#include "display_device/displayid.h"
+
+// local includes
+#include "display_device/logging.h"
+
+namespace display_device {
+  namespace {
+    constexpr std::size_t SECTION_OFFSET {1};
+    constexpr std::size_t SECTION_HEADER_SIZE {4};
+    constexpr std::size_t TILED_TOPOLOGY_SIZE {22};
+    constexpr std::uint8_t DISPLAYID_VERSION {2};
+
+    std::uint8_t toU8(const std::byte value) {
+      return std::to_integer<std::uint8_t>(value);
+    }
+  }  // namespace
+
+  bool operator==(const DisplayIdDetailedTiming &lhs, const DisplayIdDetailedTiming &rhs) {
+    return lhs.m_timing == rhs.m_timing && lhs.m_preferred == rhs.m_preferred && lhs.m_aspect_ratio == rhs.m_aspect_ratio;
+  }
+
+  bool operator==(const DisplayIdEnumeratedTiming &lhs, const DisplayIdEnumeratedTiming &rhs) {
+    return lhs.m_code_type == rhs.m_code_type && lhs.m_code == rhs.m_code;
+  }
+
+  bool operator==(const DisplayIdTiledTopology &lhs, const DisplayIdTiledTopology &rhs) {
+    return lhs.m_single_enclosure == rhs.m_single_enclosure &&
+           lhs.m_horizontal_tiles == rhs.m_horizontal_tiles && lhs.m_vertical_tiles == rhs.m_vertical_tiles &&
+           lhs.m_horizontal_location == rhs.m_horizontal_location && lhs.m_vertical_location == rhs.m_vertical_location &&
+           lhs.m_tile_resolution == rhs.m_tile_resolution && lhs.m_vendor_id == rhs.m_vendor_id &&
+           lhs.m_product_code == rhs.m_product_code && lhs.m_serial_number == rhs.m_serial_number;
+  }
+
+  std::optional<DisplayIdView> DisplayIdView::create(const std::span<const std::byte> block) {
+    if (block.size() != EdidView::BLOCK_SIZE || toU8(block[0]) != EXTENSION_TAG) {
+      return std::nullopt;
+    }
+
+    const auto version {toU8(block[SECTION_OFFSET])};
+    if ((version >> 4) != DISPLAYID_VERSION) {
+      DD_LOG_CATEGORY(edid, verbose) << "Unsupported DisplayID version: " << static_cast<int>(version >> 4) << "." << static_cast<int>(version & 0x0F);
+      return std::nullopt;
+    }
+
+    // Header + data blocks + checksum must fit before the EDID block checksum
+    const std::size_t section_size {SECTION_HEADER_SIZE + toU8(block[SECTION_OFFSET + 1])};
+    if (SECTION_OFFSET + section_size + 1 > EdidView::BLOCK_SIZE - 1) {
+      DD_LOG_CATEGORY(edid, warning) << "DisplayID section size is out of range: " << section_size;
+      return std::nullopt;
+    }
+
+    const auto section {block.subspan(SECTION_OFFSET, section_size + 1)};
+    std::uint8_t sum {0};
+    for (const auto value : section) {
+      sum = static_cast<std::uint8_t>(sum + toU8(value));
+    }
+    if (sum != 0) {
+      DD_LOG_CATEGORY(edid, warning) << "DisplayID section checksum verification failed.";
+      return std::nullopt;
+    }
+
+    return DisplayIdView {section.first(section_size)};
+  }
+
+  DisplayIdView::DisplayIdView(const std::span<const std::byte> section):
+      m_section {section},
+      m_payload {section.subspan(SECTION_HEADER_SIZE)} {
+  }
+
+  std::uint8_t DisplayIdView::getRevision() const {
+    return toU8(m_section[0]) & 0x0F;
+  }
+
+  std::uint8_t DisplayIdView::getProductType() const {
+    return toU8(m_section[2]) & 0x0F;
+  }
+
+  std::optional<DisplayIdTiledTopology> DisplayIdView::getTiledTopology() const {
+    std::optional<DisplayIdTiledTopology> topology;
+    forEachDataBlock([&topology](const std::uint8_t tag, std::uint8_t, const std::span<const std::byte> payload) {
+      if (!topology && tag == TILED_TOPOLOGY_TAG) {
+        topology = decodeTiledTopology(payload);
+      }
+    });
+
+    return topology;
+  }
+
+  DisplayIdDetailedTiming DisplayIdView::decodeDetailedTiming(const std::span<const std::byte> descriptor) {
+    const auto byte {[&descriptor](const std::size_t index) -> unsigned int {
+      return toU8(descriptor[index]);
+    }};
+    // Most of the values are stored as "value - 1"
+    const auto word {[&byte](const std::size_t index, const unsigned int mask = 0xFFFF) {
+      return static_cast<std::uint16_t>(((byte(index) | byte(index + 1) << 8) & mask) + 1);
+    }};
+
+    const unsigned int options {byte(3)};
+    return {
+      .m_timing = {
+        .m_pixel_clock_khz = (byte(0) | byte(1) << 8 | byte(2) << 16) + 1,
+        .m_h_active = word(4),
+        .m_h_blanking = word(6),
+        .m_h_sync_offset = word(8, 0x7FFF),
+        .m_h_sync_width = word(10),
+        .m_v_active = word(12),
+        .m_v_blanking = word(14),
+        .m_v_sync_offset = word(16, 0x7FFF),
+        .m_v_sync_width = word(18),
+        .m_interlaced = (options & 0x10) != 0
+      },
+      .m_preferred = (options & 0x80) != 0,
+      .m_aspect_ratio = static_cast<std::uint8_t>(options & 0x0F)
+    };
+  }
+
+  std::optional<DisplayIdTiledTopology> DisplayIdView::decodeTiledTopology(const std::span<const std::byte> payload) {
+    if (payload.size() < TILED_TOPOLOGY_SIZE) {
+      return std::nullopt;
+    }
+
+    const auto byte {[&payload](const std::size_t index) -> unsigned int {
+      return toU8(payload[index]);
+    }};
+    // Tile counts and locations are split into the lower 4 bits and the higher 2 bits
+    const auto split_value {[&byte](const std::size_t low_index, const unsigned int low_shift, const unsigned int high_shift) {
+      return static_cast<std::uint8_t>(((byte(low_index) >> low_shift) & 0x0F) | ((byte(3) >> high_shift) & 0x03) << 4);
+    }};
+
+    return DisplayIdTiledTopology {
+      .m_single_enclosure = (byte(0) & 0x80) != 0,
+      .m_horizontal_tiles = static_cast<std::uint8_t>(split_value(1, 4, 6) + 1),
+      .m_vertical_tiles = static_cast<std::uint8_t>(split_value(1, 0, 4) + 1),
+      .m_horizontal_location = split_value(2, 4, 2),
+      .m_vertical_location = split_value(2, 0, 0),
+      .m_tile_resolution = {(byte(4) | byte(5) << 8) + 1, (byte(6) | byte(7) << 8) + 1},
+      .m_vendor_id = byte(13) << 16 | byte(14) << 8 | byte(15),
+      .m_product_code = static_cast<std::uint16_t>(byte(16) | byte(17) << 8),
+      .m_serial_number = byte(18) | byte(19) << 8 | byte(20) << 16 | byte(21) << 24
+    };
+  }
+}  // namespace display_device
@@ -0,0 +1,181 @@
+/**
+ * @file src/common/edid.cpp
+ * @brief Definitions for the zero-copy EDID decoder.
+ */
+// header include
+#include "display_device/edid.h"
+
+// local includes
+#include "display_device/logging.h"
+
+namespace display_device {
+  namespace {
+    std::uint8_t toU8(const std::byte value) {
+      return std::to_integer<std::uint8_t>(value);
+    }
+  }  // namespace
+
+  bool operator==(const EdidDetailedTiming &lhs, const EdidDetailedTiming &rhs) {
+    return lhs.m_pixel_clock_khz == rhs.m_pixel_clock_khz &&
+           lhs.m_h_active == rhs.m_h_active && lhs.m_h_blanking == rhs.m_h_blanking && lhs.m_h_sync_offset == rhs.m_h_sync_offset && lhs.m_h_sync_width == rhs.m_h_sync_width &&
+           lhs.m_v_active == rhs.m_v_active && lhs.m_v_blanking == rhs.m_v_blanking && lhs.m_v_sync_offset == rhs.m_v_sync_offset && lhs.m_v_sync_width == rhs.m_v_sync_width &&
+           lhs.m_interlaced == rhs.m_interlaced;
+  }
+
+  bool operator==(const EdidVideoDescriptor &lhs, const EdidVideoDescriptor &rhs) {
+    return lhs.m_vic == rhs.m_vic && lhs.m_native == rhs.m_native;
+  }
+
+  bool operator==(const EdidAudioDescriptor &lhs, const EdidAudioDescriptor &rhs) {
+    return lhs.m_format == rhs.m_format && lhs.m_max_channels == rhs.m_max_channels && lhs.m_sample_rates == rhs.m_sample_rates && lhs.m_format_details == rhs.m_format_details;
+  }
+
+  bool operator==(const EdidHdrStaticMetadata &lhs, const EdidHdrStaticMetadata &rhs) {
+    return lhs.m_eotfs == rhs.m_eotfs && lhs.m_metadata_descriptors == rhs.m_metadata_descriptors && lhs.m_max_luminance == rhs.m_max_luminance &&
+           lhs.m_max_frame_avg_luminance == rhs.m_max_frame_avg_luminance && lhs.m_min_luminance == rhs.m_min_luminance;
+  }
+
+  Rational EdidDetailedTiming::getRefreshRate() const {
+    const unsigned int total_pixels {(static_cast<unsigned int>(m_h_active) + m_h_blanking) * (static_cast<unsigned int>(m_v_active) + m_v_blanking)};
+    return {m_pixel_clock_khz * 1000, total_pixels};
+  }
+
+  bool EdidHdrStaticMetadata::isEotfSupported(const Eotf eotf) const {
+    return (m_eotfs & static_cast<std::uint8_t>(eotf)) != 0;
+  }
+
+  std::optional<EdidView> EdidView::create(const std::span<const std::byte> data) {
+    if (data.empty()) {
+      return std::nullopt;
+    }
+
+    if (data.size() < BLOCK_SIZE) {
+      DD_LOG_CATEGORY(edid, warning) << "EDID data size is too small: " << data.size();
+      return std::nullopt;
+    }
+
+    // ---- Verify fixed header
+    if (!hasFixedHeader(data)) {
+      DD_LOG_CATEGORY(edid, warning) << "EDID data does not contain fixed header.";
+      return std::nullopt;
+    }
+
+    // ---- Verify checksum
+    if (!isChecksumValid(data.first(BLOCK_SIZE))) {
+      DD_LOG_CATEGORY(edid, warning) << "EDID checksum verification failed.";
+      return std::nullopt;
+    }
+
+    const std::size_t declared_blocks {1 + static_cast<std::size_t>(toU8(data[126]))};
+    const std::size_t available_blocks {std::min(declared_blocks, data.size() / BLOCK_SIZE)};
+    if (available_blocks < declared_blocks) {
+      DD_LOG_CATEGORY(edid, verbose) << "EDID data is missing " << (declared_blocks - available_blocks) << " extension block(s).";
+    }
+
+    return EdidView {data.first(available_blocks * BLOCK_SIZE)};
+  }
+
+  EdidView::EdidView(const std::span<const std::byte> data):
+      m_data {data} {
+  }
+
+  std::size_t EdidView::getBlockCount() const {
+    return m_data.size() / BLOCK_SIZE;
+  }
+
+  std::span<const std::byte> EdidView::getBlock(const std::size_t index) const {
+    if (index >= getBlockCount()) {
+      return {};
+    }
+    return m_data.subspan(index * BLOCK_SIZE, BLOCK_SIZE);
+  }
+
+  bool EdidView::isBlockValid(const std::size_t index) const {
+    const auto block {getBlock(index)};
+    return isChecksumValid(block);
+  }
+
+  std::optional<EdidDetailedTiming> EdidView::getPreferredTiming() const {
+    return decodeDetailedTiming(m_data.subspan(BASE_DESCRIPTORS_OFFSET, DESCRIPTOR_SIZE));
+  }
+
+  std::optional<EdidHdrStaticMetadata> EdidView::getHdrStaticMetadata() const {
+    constexpr std::uint8_t extended_tag {7};
+    constexpr std::uint8_t hdr_static_metadata_tag {6};
+
+    std::optional<EdidHdrStaticMetadata> metadata;
+    forEachCtaDataBlock([&metadata](const std::uint8_t tag, const std::span<const std::byte> payload) {
+      if (metadata || tag != extended_tag || payload.size() < 3 || toU8(payload[0]) != hdr_static_metadata_tag) {
+        return;
+      }
+
+      metadata = EdidHdrStaticMetadata {
+        .m_eotfs = static_cast<std::uint8_t>(toU8(payload[1]) & 0x3F),
+        .m_metadata_descriptors = toU8(payload[2])
+      };
+      if (payload.size() > 3) {
+        metadata->m_max_luminance = toU8(payload[3]);
+      }
+      if (payload.size() > 4) {
+        metadata->m_max_frame_avg_luminance = toU8(payload[4]);
+      }
+      if (payload.size() > 5) {
+        metadata->m_min_luminance = toU8(payload[5]);
+      }
+    });
+
+    return metadata;
+  }
+
+  std::optional<EdidDetailedTiming> EdidView::decodeDetailedTiming(const std::span<const std::byte> descriptor) {
+    if (descriptor.size() < DESCRIPTOR_SIZE) {
+      return std::nullopt;
+    }
+
+    const auto byte {[&descriptor](const std::size_t index) -> unsigned int {
+      return toU8(descriptor[index]);
+    }};
+
+    const unsigned int pixel_clock {byte(0) | byte(1) << 8};
+    if (pixel_clock == 0) {
+      // Display descriptor (monitor name, range limits, etc.)
+      return std::nullopt;
+    }
+
+    return EdidDetailedTiming {
+      .m_pixel_clock_khz = pixel_clock * 10,
+      .m_h_active = static_cast<std::uint16_t>(byte(2) | (byte(4) & 0xF0) << 4),
+      .m_h_blanking = static_cast<std::uint16_t>(byte(3) | (byte(4) & 0x0F) << 8),
+      .m_h_sync_offset = static_cast<std::uint16_t>(byte(8) | (byte(11) & 0xC0) << 2),
+      .m_h_sync_width = static_cast<std::uint16_t>(byte(9) | (byte(11) & 0x30) << 4),
+      .m_v_active = static_cast<std::uint16_t>(byte(5) | (byte(7) & 0xF0) << 4),
+      .m_v_blanking = static_cast<std::uint16_t>(byte(6) | (byte(7) & 0x0F) << 8),
+      .m_v_sync_offset = static_cast<std::uint16_t>(byte(10) >> 4 | (byte(11) & 0x0C) << 2),
+      .m_v_sync_width = static_cast<std::uint16_t>((byte(10) & 0x0F) | (byte(11) & 0x03) << 4),
+      .m_interlaced = (byte(17) & 0x80) != 0
+    };
+  }
+
+  std::optional<EdidVideoDescriptor> EdidView::decodeVideoDescriptor(const std::byte descriptor) {
+    const auto value {toU8(descriptor)};
+    if (value == 0 || value == 128 || value >= 254) {
+      // Reserved values
+      return std::nullopt;
+    }
+
+    // Native flag is only encoded for the first 64 VICs (CTA-861-F and above)
+    if (value >= 129 && value <= 192) {
+      return EdidVideoDescriptor {static_cast<std::uint8_t>(value & 0x7F), true};
+    }
+    return EdidVideoDescriptor {value, false};
+  }
+
+  EdidAudioDescriptor EdidView::decodeAudioDescriptor(const std::span<const std::byte> descriptor) {
+    return {
+      .m_format = static_cast<std::uint8_t>((toU8(descriptor[0]) >> 3) & 0x0F),
+      .m_max_channels = static_cast<std::uint8_t>((toU8(descriptor[0]) & 0x07) + 1),
+      .m_sample_rates = static_cast<std::uint8_t>(toU8(descriptor[1]) & 0x7F),
+      .m_format_details = toU8(descriptor[2])
+    };
+  }
+}  // namespace display_device
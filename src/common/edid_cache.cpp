@@ -0,0 +1,84 @@
+/**
+ * @file src/common/edid_cache.cpp
+ * @brief Definitions for the EdidCache.
+ */
+// class header include
+#include "display_device/edid_cache.h"
+
+// system includes
+#include <algorithm>
+#include <stdexcept>
+
+// local includes
+#include "display_device/detail/hash.h"
+#include "display_device/edid.h"
+
+namespace display_device {
+  EdidCache &EdidCache::get() {
+    static EdidCache instance;  // GCOVR_EXCL_BR_LINE for some reason...
+    return instance;
+  }
+
+  EdidCache::EdidCache(const std::size_t capacity):
+      m_capacity {capacity} {
+    if (m_capacity == 0) {
+      throw std::logic_error {"Zero capacity provided for EdidCache!"};
+    }
+  }
+
+  std::shared_ptr<const EdidData> EdidCache::parse(const std::span<const std::byte> data) {
+    const auto hash {detail::hashBytes64(data)};
+
+    {
+      std::lock_guard lock {m_mutex};
+      if (const auto it {m_index.find(hash)}; it != std::end(m_index)) {
+        auto &entry {*it->second};
+        if (std::ranges::equal(entry.m_data, data)) {
+          m_entries.splice(std::begin(m_entries), m_entries, it->second);
+          m_hits.fetch_add(1, std::memory_order_relaxed);
+          return entry.m_edid;
+        }
+      }
+    }
+
+    // Parsing outside the lock, so that concurrent lookups for other data are not blocked
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    const auto view {EdidView::create(data)};
+    const auto parsed {view ? EdidData::fromView(*view) : std::nullopt};
+    std::shared_ptr<const EdidData> edid {parsed ? std::make_shared<const EdidData>(*parsed) : nullptr};
+
+    std::lock_guard lock {m_mutex};
+    if (const auto it {m_index.find(hash)}; it != std::end(m_index)) {
+      // Either another thread was faster or it's a collision - the latest data wins
+      m_entries.erase(it->second);
+      m_index.erase(it);
+    }
+
+    m_entries.push_front({hash, {std::begin(data), std::end(data)}, edid});
+    m_index[hash] = std::begin(m_entries);
+
+    while (m_entries.size() > m_capacity) {
+      m_index.erase(m_entries.back().m_hash);
+      m_entries.pop_back();
+      m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return edid;
+  }
+
+  void EdidCache::clear() {
+    std::lock_guard lock {m_mutex};
+    m_index.clear();
+    m_entries.clear();
+  }
+
+  EdidCache::Stats EdidCache::getStats() const {
+    std::lock_guard lock {m_mutex};
+    return {
+      m_hits.load(std::memory_order_relaxed),
+      m_misses.load(std::memory_order_relaxed),
+      m_evictions.load(std::memory_order_relaxed),
+      m_entries.size()
+    };
+  }
+}  // namespace display_device
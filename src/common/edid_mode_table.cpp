@@ -0,0 +1,242 @@
+/**
+ * @file src/common/edid_mode_table.cpp
+ * @brief Definitions for the EDID derived display mode table.
+ */
+// class header include
+#include "display_device/edid_mode_table.h"
+
+// system includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief A timing from the established timings bitmap.
+     */
+    struct EstablishedTiming {
+      unsigned int m_width;
+      unsigned int m_height;
+      unsigned int m_refresh_rate;
+      bool m_interlaced;
+    };
+
+    constexpr std::size_t ESTABLISHED_TIMINGS_OFFSET {35};
+    constexpr std::size_t STANDARD_TIMINGS_OFFSET {38};
+    constexpr std::size_t STANDARD_TIMING_COUNT {8};
+    constexpr std::size_t VERSION_REVISION_OFFSET {19};
+    constexpr double REFRESH_RATE_EPSILON {0.001};
+
+    /**
+     * @brief Established timings in the order of bits (MSB of the first byte first).
+     */
+    constexpr std::array<EstablishedTiming, 17> ESTABLISHED_TIMINGS {{
+      {720, 400, 70, false},
+      {720, 400, 88, false},
+      {640, 480, 60, false},
+      {640, 480, 67, false},
+      {640, 480, 72, false},
+      {640, 480, 75, false},
+      {800, 600, 56, false},
+      {800, 600, 60, false},
+      {800, 600, 72, false},
+      {800, 600, 75, false},
+      {832, 624, 75, false},
+      {1024, 768, 87, true},
+      {1024, 768, 60, false},
+      {1024, 768, 70, false},
+      {1024, 768, 75, false},
+      {1280, 1024, 75, false},
+      {1152, 870, 75, false},
+    }};
+
+    double toDouble(const double value) {
+      return value;
+    }
+
+    double toDouble(const Rational &value) {
+      return value.m_denominator == 0 ? 0. : static_cast<double>(value.m_numerator) / static_cast<double>(value.m_denominator);
+    }
+
+    double toDouble(const FloatingPoint &value) {
+      return std::visit([](const auto &v) {
+        return toDouble(v);
+      },
+                        value);
+    }
+
+    std::uint64_t getPixelCount(const Resolution &resolution) {
+      return static_cast<std::uint64_t>(resolution.m_width) * resolution.m_height;
+    }
+
+    std::uint64_t absDiff(const std::uint64_t lhs, const std::uint64_t rhs) {
+      return lhs > rhs ? lhs - rhs : rhs - lhs;
+    }
+
+    /**
+     * @brief Decode the 2-byte standard timing.
+     * @param data Standard timing data.
+     * @param revision EDID structure revision, which defines the meaning of the 16:10 aspect ratio bits.
+     * @returns Decoded mode or empty optional for the unused entry.
+     */
+    std::optional<EdidMode> decodeStandardTiming(const std::span<const std::byte> data, const std::uint8_t revision) {
+      const auto first {std::to_integer<unsigned int>(data[0])};
+      const auto second {std::to_integer<unsigned int>(data[1])};
+      if (first == 0x00 || (first == 0x01 && second == 0x01)) {
+        return std::nullopt;
+      }
+
+      const unsigned int width {(first + 31) * 8};
+      unsigned int height {};
+      switch (second >> 6) {
+        case 0:
+          // Before EDID 1.3 this meant 1:1
+          height = revision < 3 ? width : width * 10 / 16;
+          break;
+        case 1:
+          height = width * 3 / 4;
+          break;
+        case 2:
+          height = width * 4 / 5;
+          break;
+        default:
+          height = width * 9 / 16;
+          break;
+      }
+
+      return EdidMode {{width, height}, {(second & 0x3F) + 60, 1}};
+    }
+  }  // namespace
+
+  bool operator==(const EdidMode &lhs, const EdidMode &rhs) {
+    return lhs.m_resolution == rhs.m_resolution && lhs.m_refresh_rate == rhs.m_refresh_rate;
+  }
+
+  EdidModeTable EdidModeTable::create(const EdidView &view) {
+    std::vector<EdidMode> modes;
+    const auto base_block {view.getBlock(0)};
+
+    // ---- Established timings
+    for (std::size_t index {0}; index < ESTABLISHED_TIMINGS.size(); ++index) {
+      const auto byte {std::to_integer<unsigned int>(base_block[ESTABLISHED_TIMINGS_OFFSET + index / 8])};
+      const auto &timing {ESTABLISHED_TIMINGS[index]};
+      if ((byte & (0x80u >> (index % 8))) != 0 && !timing.m_interlaced) {
+        modes.push_back({{timing.m_width, timing.m_height}, {timing.m_refresh_rate, 1}});
+      }
+    }
+
+    // ---- Standard timings
+    const auto revision {std::to_integer<std::uint8_t>(base_block[VERSION_REVISION_OFFSET])};
+    for (std::size_t index {0}; index < STANDARD_TIMING_COUNT; ++index) {
+      if (const auto mode {decodeStandardTiming(base_block.subspan(STANDARD_TIMINGS_OFFSET + index * 2, 2), revision)}; mode) {
+        modes.push_back(*mode);
+      }
+    }
+
+    // ---- Detailed timings
+    view.forEachDetailedTiming([&modes](const EdidDetailedTiming &timing) {
+      if (!timing.m_interlaced) {
+        modes.push_back({{timing.m_h_active, timing.m_v_active}, timing.getRefreshRate()});
+      }
+    });
+
+    std::ranges::sort(modes, [](const EdidMode &lhs, const EdidMode &rhs) {
+      if (lhs.m_resolution.m_width != rhs.m_resolution.m_width) {
+        return lhs.m_resolution.m_width < rhs.m_resolution.m_width;
+      }
+      if (lhs.m_resolution.m_height != rhs.m_resolution.m_height) {
+        return lhs.m_resolution.m_height < rhs.m_resolution.m_height;
+      }
+      return toDouble(lhs.m_refresh_rate) < toDouble(rhs.m_refresh_rate);
+    });
+
+    EdidModeTable table;
+    table.m_modes.reserve(modes.size());
+    for (const auto &mode : modes) {
+      if (!table.m_modes.empty()) {
+        auto &last {table.m_modes.back()};
+        if (last.m_resolution == mode.m_resolution && std::abs(toDouble(last.m_refresh_rate) - toDouble(mode.m_refresh_rate)) < REFRESH_RATE_EPSILON) {
+          // Same mode from a different source - prefer the precise refresh rate of the detailed timing
+          if (last.m_refresh_rate.m_denominator == 1) {
+            last = mode;
+          }
+          continue;
+        }
+      }
+
+      table.m_modes.push_back(mode);
+    }
+
+    for (std::size_t index {0}; index < table.m_modes.size(); ++index) {
+      if (table.m_ranges.empty() || !(table.m_ranges.back().m_resolution == table.m_modes[index].m_resolution)) {
+        table.m_ranges.push_back({table.m_modes[index].m_resolution, index, index});
+      }
+      table.m_ranges.back().m_end = index + 1;
+    }
+
+    std::ranges::sort(table.m_ranges, [](const ResolutionRange &lhs, const ResolutionRange &rhs) {
+      const auto lhs_count {getPixelCount(lhs.m_resolution)};
+      const auto rhs_count {getPixelCount(rhs.m_resolution)};
+      return lhs_count != rhs_count ? lhs_count < rhs_count : lhs.m_resolution.m_width < rhs.m_resolution.m_width;
+    });
+
+    return table;
+  }
+
+  const std::vector<EdidMode> &EdidModeTable::getModes() const {
+    return m_modes;
+  }
+
+  std::optional<EdidMode> EdidModeTable::findClosestMode(const Resolution &resolution, const std::optional<FloatingPoint> &refresh_rate) const {
+    if (m_ranges.empty()) {
+      return std::nullopt;
+    }
+
+    // ---- Resolution lookup
+    const auto pixel_count {getPixelCount(resolution)};
+    auto range_it {std::ranges::lower_bound(m_ranges, std::make_pair(pixel_count, resolution.m_width), std::less {}, [](const ResolutionRange &range) {
+      return std::make_pair(getPixelCount(range.m_resolution), range.m_resolution.m_width);
+    })};
+
+    if (range_it == std::end(m_ranges)) {
+      range_it = std::prev(range_it);
+    } else if (range_it != std::begin(m_ranges)) {
+      const auto prev_it {std::prev(range_it)};
+      const auto distance = [pixel_count, &resolution](const ResolutionRange &range) {
+        return std::make_pair(absDiff(getPixelCount(range.m_resolution), pixel_count), absDiff(range.m_resolution.m_width, resolution.m_width));
+      };
+
+      if (distance(*prev_it) <= distance(*range_it)) {
+        range_it = prev_it;
+      }
+    }
+
+    // ---- Refresh rate lookup
+    const auto modes {std::span {m_modes}.subspan(range_it->m_begin, range_it->m_end - range_it->m_begin)};
+    if (!refresh_rate) {
+      return modes.back();
+    }
+
+    const double requested_rate {toDouble(*refresh_rate)};
+    auto mode_it {std::ranges::lower_bound(modes, requested_rate, std::less {}, [](const EdidMode &mode) {
+      return toDouble(mode.m_refresh_rate);
+    })};
+
+    if (mode_it == std::end(modes)) {
+      mode_it = std::prev(mode_it);
+    } else if (mode_it != std::begin(modes)) {
+      const auto prev_it {std::prev(mode_it)};
+      if (requested_rate - toDouble(prev_it->m_refresh_rate) <= toDouble(mode_it->m_refresh_rate) - requested_rate) {
+        mode_it = prev_it;
+      }
+    }
+
+    return *mode_it;
+  }
+
+  std::optional<EdidMode> EdidModeTable::findClosestMode(const SingleDisplayConfiguration &config, const Resolution &current_resolution) const {
+    return findClosestMode(config.m_resolution.value_or(current_resolution), config.m_refresh_rate);
+  }
+}  // namespace display_device
@@ -0,0 +1,107 @@
+/**
+ * @file src/common/edid_stream_parser.cpp
+ * @brief Definitions for the incremental EDID parser.
+ */
+// class header include
+#include "display_device/edid_stream_parser.h"
+
+// system includes
+#include <algorithm>
+
+// local includes
+#include "display_device/logging.h"
+
+namespace display_device {
+  EdidStreamParser::EdidStreamParser(const Scope scope):
+      m_scope {scope} {
+  }
+
+  EdidStreamParser::Status EdidStreamParser::feed(const std::span<const std::byte> data) {
+    if (m_status != Status::NeedMoreData) {
+      return m_status;
+    }
+
+    const std::size_t expected_size {m_expected_blocks * EdidView::BLOCK_SIZE};
+    const auto chunk {data.first(std::min(data.size(), expected_size - m_data.size()))};
+    const bool had_base_block {m_data.size() >= EdidView::BLOCK_SIZE};
+    m_data.insert(std::end(m_data), std::begin(chunk), std::end(chunk));
+
+    if (!had_base_block && m_data.size() >= EdidView::BLOCK_SIZE) {
+      if (!processBaseBlock()) {
+        m_status = Status::Failed;
+        return m_status;
+      }
+
+      // Extension blocks might already be in the remaining data
+      if (m_expected_blocks > 1) {
+        return feed(data.subspan(chunk.size()));
+      }
+    }
+
+    if (m_data.size() == m_expected_blocks * EdidView::BLOCK_SIZE) {
+      m_status = Status::Complete;
+    }
+    return m_status;
+  }
+
+  EdidStreamParser::Status EdidStreamParser::getStatus() const {
+    return m_status;
+  }
+
+  std::size_t EdidStreamParser::getBlocksNeeded() const {
+    if (m_status != Status::NeedMoreData) {
+      return 0;
+    }
+
+    const std::size_t received_blocks {m_data.size() / EdidView::BLOCK_SIZE};
+    return m_expected_blocks - received_blocks;
+  }
+
+  std::optional<EdidData> EdidStreamParser::getEdidData() const {
+    return m_edid_data;
+  }
+
+  std::optional<EdidView> EdidStreamParser::getView() const {
+    if (!m_edid_data) {
+      return std::nullopt;
+    }
+
+    const std::size_t received_blocks {m_data.size() / EdidView::BLOCK_SIZE};
+    return EdidView {std::span {m_data}.first(received_blocks * EdidView::BLOCK_SIZE)};
+  }
+
+  void EdidStreamParser::reset() {
+    m_status = Status::NeedMoreData;
+    m_data.clear();
+    m_expected_blocks = 1;
+    m_edid_data = std::nullopt;
+  }
+
+  bool EdidStreamParser::processBaseBlock() {
+    const auto base_block {std::span {m_data}.first(EdidView::BLOCK_SIZE)};
+
+    // ---- Verify fixed header
+    if (!EdidView::hasFixedHeader(base_block)) {
+      DD_LOG_CATEGORY(edid, warning) << "EDID data does not contain fixed header.";
+      return false;
+    }
+
+    // ---- Verify checksum
+    if (!EdidView::isChecksumValid(base_block)) {
+      DD_LOG_CATEGORY(edid, warning) << "EDID checksum verification failed.";
+      return false;
+    }
+
+    m_edid_data = EdidData::fromView(EdidView {base_block});
+    if (!m_edid_data) {
+      // Error already logged
+      return false;
+    }
+
+    if (m_scope == Scope::AllBlocks) {
+      m_expected_blocks += std::to_integer<std::size_t>(base_block[126]);
+      m_data.reserve(m_expected_blocks * EdidView::BLOCK_SIZE);
+    }
+    return true;
+  }
+}  // namespace display_device
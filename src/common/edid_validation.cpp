@@ -0,0 +1,192 @@
+/**
+ * @file src/common/edid_validation.cpp
+ * @brief Definitions for the batched EDID validation.
+ */
+// header include
+#include "display_device/edid_validation.h"
+
+// system includes
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+// local includes
+#include "display_device/detail/edid_checksum.h"
+
+// special system includes for the SIMD implementations
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+  #define DD_EDID_CHECKSUM_X86
+  #include <immintrin.h>
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #define DD_EDID_CHECKSUM_NEON
+  #include <arm_neon.h>
+#endif
+
+// MSVC allows using the intrinsics without enabling them for the whole unit, while GCC and Clang need a target attribute
+#if defined(__GNUC__) || defined(__clang__)
+  #define DD_EDID_CHECKSUM_TARGET(name) __attribute__((target(name)))
+#else
+  #define DD_EDID_CHECKSUM_TARGET(name)
+#endif
+
+namespace display_device {
+  namespace {
+    constexpr std::size_t BLOCK_SIZE {128};
+    constexpr std::array<std::uint8_t, 8> FIXED_HEADER {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+
+    std::uint8_t sumBlockScalar(const std::byte *block) {
+      unsigned int sum {0};
+      for (std::size_t i {0}; i < BLOCK_SIZE; ++i) {
+        sum += std::to_integer<unsigned int>(block[i]);
+      }
+      return static_cast<std::uint8_t>(sum);
+    }
+
+#if defined(DD_EDID_CHECKSUM_X86)
+    DD_EDID_CHECKSUM_TARGET("sse2")
+    std::uint8_t sumBlockSse2(const std::byte *block) {
+      // SAD against zero produces horizontal byte sums in the lower 16 bits of both 64-bit lanes
+      const __m128i zero {_mm_setzero_si128()};
+      __m128i acc {_mm_setzero_si128()};
+      for (std::size_t offset {0}; offset < BLOCK_SIZE; offset += sizeof(__m128i)) {
+        const __m128i chunk {_mm_loadu_si128(reinterpret_cast<const __m128i *>(block + offset))};
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(chunk, zero));
+      }
+
+      return static_cast<std::uint8_t>(_mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_srli_si128(acc, 8)));
+    }
+
+    DD_EDID_CHECKSUM_TARGET("avx2")
+    std::uint8_t sumBlockAvx2(const std::byte *block) {
+      const __m256i zero {_mm256_setzero_si256()};
+      __m256i acc {_mm256_setzero_si256()};
+      for (std::size_t offset {0}; offset < BLOCK_SIZE; offset += sizeof(__m256i)) {
+        const __m256i chunk {_mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + offset))};
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(chunk, zero));
+      }
+
+      const __m128i half {_mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1))};
+      return static_cast<std::uint8_t>(_mm_cvtsi128_si32(half) + _mm_cvtsi128_si32(_mm_srli_si128(half, 8)));
+    }
+
+    struct CpuFeatures {
+      bool m_sse2 {};
+      bool m_avx2 {};
+    };
+
+    CpuFeatures detectCpuFeatures() {
+      CpuFeatures features {};
+  #if defined(_MSC_VER) && !defined(__clang__)
+      std::array<int, 4> info {};
+      __cpuid(info.data(), 0);
+      const int max_leaf {info[0]};
+
+      __cpuid(info.data(), 1);
+      features.m_sse2 = (info[3] & (1 << 26)) != 0;
+      const bool os_xsave {(info[2] & (1 << 27)) != 0};
+      const bool avx {(info[2] & (1 << 28)) != 0};
+
+      if (max_leaf >= 7 && os_xsave && avx) {
+        // The OS must also be saving the YMM registers
+        __cpuidex(info.data(), 7, 0);
+        features.m_avx2 = (info[1] & (1 << 5)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+      }
+  #else
+      __builtin_cpu_init();
+      features.m_sse2 = __builtin_cpu_supports("sse2");
+      features.m_avx2 = __builtin_cpu_supports("avx2");
+  #endif
+      return features;
+    }
+#elif defined(DD_EDID_CHECKSUM_NEON)
+    std::uint8_t sumBlockNeon(const std::byte *block) {
+      // NEON is mandatory for AArch64, no runtime detection is needed
+      const auto data {reinterpret_cast<const std::uint8_t *>(block)};
+      uint16x8_t acc {vdupq_n_u16(0)};
+      for (std::size_t offset {0}; offset < BLOCK_SIZE; offset += 16) {
+        acc = vpadalq_u8(acc, vld1q_u8(data + offset));
+      }
+      return static_cast<std::uint8_t>(vaddvq_u16(acc));
+    }
+#endif
+
+    /**
+     * @brief Supported implementations, detected once.
+     */
+    struct SupportedImpls {
+      std::array<detail::EdidBlockSumImpl, 3> m_impls {};
+      std::size_t m_count {};
+
+      SupportedImpls() {
+        m_impls[m_count++] = {"scalar", &sumBlockScalar};
+#if defined(DD_EDID_CHECKSUM_X86)
+        const auto features {detectCpuFeatures()};
+        if (features.m_sse2) {
+          m_impls[m_count++] = {"sse2", &sumBlockSse2};
+        }
+        if (features.m_avx2) {
+          m_impls[m_count++] = {"avx2", &sumBlockAvx2};
+        }
+#elif defined(DD_EDID_CHECKSUM_NEON)
+        m_impls[m_count++] = {"neon", &sumBlockNeon};
+#endif
+      }
+    };
+
+    const SupportedImpls &getSupportedImpls() {
+      static const SupportedImpls impls;
+      return impls;
+    }
+
+    EdidValidationResult validate(const std::span<const std::byte> data, const detail::EdidBlockSumFunction sum_block) {
+      if (data.size() < BLOCK_SIZE) {
+        return EdidValidationResult::InvalidSize;
+      }
+
+      if (std::memcmp(data.data(), FIXED_HEADER.data(), FIXED_HEADER.size()) != 0) {
+        return EdidValidationResult::InvalidHeader;
+      }
+
+      const std::size_t declared_blocks {1 + std::to_integer<std::size_t>(data[126])};
+      const std::size_t available_blocks {std::min(declared_blocks, data.size() / BLOCK_SIZE)};
+      for (std::size_t index {0}; index < available_blocks; ++index) {
+        if (sum_block(data.data() + index * BLOCK_SIZE) != 0) {
+          return EdidValidationResult::InvalidChecksum;
+        }
+      }
+
+      return EdidValidationResult::Valid;
+    }
+  }  // namespace
+
+  namespace detail {
+    std::span<const EdidBlockSumImpl> getSupportedEdidBlockSumImpls() {
+      const auto &impls {getSupportedImpls()};
+      return std::span {impls.m_impls}.first(impls.m_count);
+    }
+
+    EdidBlockSumFunction getEdidBlockSumFunction() {
+      static const auto best_function {getSupportedEdidBlockSumImpls().back().m_function};
+      return best_function;
+    }
+  }  // namespace detail
+
+  EdidValidationResult validateEdid(const std::span<const std::byte> data) {
+    return validate(data, detail::getEdidBlockSumFunction());
+  }
+
+  void validateEdids(const std::span<const std::span<const std::byte>> edids, const std::span<EdidValidationResult> results) {
+    if (edids.size() != results.size()) {
+      throw std::logic_error {"Result count does not match the EDID count in validateEdids!"};
+    }
+
+    const auto sum_block {detail::getEdidBlockSumFunction()};
+    for (std::size_t i {0}; i < edids.size(); ++i) {
+      results[i] = validate(edids[i], sum_block);
+    }
+  }
+}  // namespace display_device
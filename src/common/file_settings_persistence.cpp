@@ -25,15 +25,15 @@ namespace display_device {
     try {
       std::ofstream stream {m_filepath, std::ios::binary | std::ios::trunc};
       if (!stream) {
-        DD_LOG(error) << "Failed to open " << m_filepath << " for writing!";
+        DD_LOG_CATEGORY(persistence, error) << "Failed to open " << m_filepath << " for writing!";
         return false;
       }
 
       std::copy(std::begin(data), std::end(data), std::ostreambuf_iterator<char> {stream});
       return true;
     } catch (const std::exception &error) {
-      DD_LOG(error) << "Failed to write to " << m_filepath << "! Error:\n"
-                    << error.what();
+      DD_LOG_CATEGORY(persistence, error) << "Failed to write to " << m_filepath << "! Error:\n"
+                                          << error.what();
       return false;
     }
   }
@@ -41,8 +41,8 @@ namespace display_device {
   std::optional<std::vector<std::uint8_t>> FileSettingsPersistence::load() const {
     if (std::error_code error_code; !std::filesystem::exists(m_filepath, error_code)) {
       if (error_code) {
-        DD_LOG(error) << "Failed to load " << m_filepath << "! Error:\n"
-                      << "[" << error_code.value() << "] " << error_code.message();
+        DD_LOG_CATEGORY(persistence, error) << "Failed to load " << m_filepath << "! Error:\n"
+                                            << "[" << error_code.value() << "] " << error_code.message();
         return std::nullopt;
       }
 
@@ -52,14 +52,14 @@ namespace display_device {
     try {
       std::ifstream stream {m_filepath, std::ios::binary};
       if (!stream) {
-        DD_LOG(error) << "Failed to open " << m_filepath << " for reading!";
+        DD_LOG_CATEGORY(persistence, error) << "Failed to open " << m_filepath << " for reading!";
         return std::nullopt;
       }
 
       return std::vector<std::uint8_t> {std::istreambuf_iterator<char> {stream}, std::istreambuf_iterator<char> {}};
     } catch (const std::exception &error) {
-      DD_LOG(error) << "Failed to read " << m_filepath << "! Error:\n"
-                    << error.what();
+      DD_LOG_CATEGORY(persistence, error) << "Failed to read " << m_filepath << "! Error:\n"
+                                          << error.what();
       return std::nullopt;
     }
   }
@@ -70,8 +70,8 @@ namespace display_device {
     std::filesystem::remove(m_filepath, error_code);
 
     if (error_code) {
-      DD_LOG(error) << "Failed to remove " << m_filepath << "! Error:\n"
-                    << "[" << error_code.value() << "] " << error_code.message();
+      DD_LOG_CATEGORY(persistence, error) << "Failed to remove " << m_filepath << "! Error:\n"
+                                          << "[" << error_code.value() << "] " << error_code.message();
       return false;
     }
 
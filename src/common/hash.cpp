@@ -0,0 +1,112 @@
+/**
+ * @file src/common/hash.cpp
+ * @brief Definitions for private non-cryptographic hashing helpers.
+ */
+// header include
+#include "display_device/detail/hash.h"
+
+// system includes
+#include <algorithm>
+
+namespace display_device::detail {
+  namespace {
+    constexpr std::uint64_t C1 {0x87C37B91114253D5ULL};
+    constexpr std::uint64_t C2 {0x4CF5AD432745937FULL};
+
+    constexpr std::uint64_t rotl(const std::uint64_t value, const int shift) {
+      return (value << shift) | (value >> (64 - shift));
+    }
+
+    constexpr std::uint64_t finalMix(std::uint64_t value) {
+      value ^= value >> 33;
+      value *= 0xFF51AFD7ED558CCDULL;
+      value ^= value >> 33;
+      value *= 0xC4CEB9FE1A85EC53ULL;
+      value ^= value >> 33;
+      return value;
+    }
+
+    /**
+     * @brief Read up to 8 bytes as a little-endian value (independent of the host endianness).
+     */
+    std::uint64_t readLittleEndian(const std::byte *data, const std::size_t size) {
+      std::uint64_t value {0};
+      for (std::size_t i {0}; i < size; ++i) {
+        value |= std::to_integer<std::uint64_t>(data[i]) << (8 * i);
+      }
+      return value;
+    }
+  }  // namespace
+
+  bool operator==(const Hash128 &lhs, const Hash128 &rhs) {
+    return lhs.m_low == rhs.m_low && lhs.m_high == rhs.m_high;
+  }
+
+  Hash128 hashBytes128(const std::span<const std::byte> data, const std::uint64_t seed) {
+    constexpr std::size_t block_size {16};
+    const std::size_t block_count {data.size() / block_size};
+
+    std::uint64_t h1 {seed};
+    std::uint64_t h2 {seed};
+
+    // ---- Body
+    for (std::size_t i {0}; i < block_count; ++i) {
+      std::uint64_t k1 {readLittleEndian(data.data() + i * block_size, 8)};
+      std::uint64_t k2 {readLittleEndian(data.data() + i * block_size + 8, 8)};
+
+      k1 *= C1;
+      k1 = rotl(k1, 31);
+      k1 *= C2;
+      h1 ^= k1;
+
+      h1 = rotl(h1, 27);
+      h1 += h2;
+      h1 = h1 * 5 + 0x52DCE729;
+
+      k2 *= C2;
+      k2 = rotl(k2, 33);
+      k2 *= C1;
+      h2 ^= k2;
+
+      h2 = rotl(h2, 31);
+      h2 += h1;
+      h2 = h2 * 5 + 0x38495AB5;
+    }
+
+    // ---- Tail
+    const auto tail {data.subspan(block_count * block_size)};
+    if (tail.size() > 8) {
+      std::uint64_t k2 {readLittleEndian(tail.data() + 8, tail.size() - 8)};
+      k2 *= C2;
+      k2 = rotl(k2, 33);
+      k2 *= C1;
+      h2 ^= k2;
+    }
+    if (!tail.empty()) {
+      std::uint64_t k1 {readLittleEndian(tail.data(), std::min<std::size_t>(tail.size(), 8))};
+      k1 *= C1;
+      k1 = rotl(k1, 31);
+      k1 *= C2;
+      h1 ^= k1;
+    }
+
+    // ---- Finalization
+    h1 ^= data.size();
+    h2 ^= data.size();
+
+    h1 += h2;
+    h2 += h1;
+
+    h1 = finalMix(h1);
+    h2 = finalMix(h2);
+
+    h1 += h2;
+    h2 += h1;
+
+    return {h1, h2};
+  }
+
+  std::uint64_t hashBytes64(const std::span<const std::byte> data) {
+    return hashBytes128(data).m_low;
+  }
+}  // namespace display_device::detail
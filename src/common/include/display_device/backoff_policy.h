@@ -0,0 +1,144 @@
+/**
+ * @file src/common/include/display_device/backoff_policy.h
+ * @brief Declarations for the retry backoff policies.
+ */
+#pragma once
+
+// system includes
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <variant>
+#include <vector>
+
+namespace display_device {
+  /**
+   * @brief Uses the durations from the list one by one. The last duration is reused indefinitely.
+   * @examples
+   * ListBackoff policy {.m_durations = {50ms, 100ms, 1s}};
+   * @examples_end
+   */
+  struct ListBackoff {
+    std::vector<std::chrono::milliseconds> m_durations {}; /**< Durations to be used (must not be empty). */
+    std::size_t m_index {0}; /**< Index of the next duration. */
+
+    /**
+     * @brief Get the next duration.
+     * @returns Duration to sleep before the next retry.
+     */
+    [[nodiscard]] std::chrono::milliseconds next();
+  };
+
+  /**
+   * @brief Always uses the same duration.
+   * @examples
+   * ConstantBackoff policy {.m_duration = 1s};
+   * @examples_end
+   */
+  struct ConstantBackoff {
+    std::chrono::milliseconds m_duration; /**< Duration to be used. */
+
+    /**
+     * @brief Get the next duration.
+     * @returns Duration to sleep before the next retry.
+     */
+    [[nodiscard]] std::chrono::milliseconds next() const;
+  };
+
+  /**
+   * @brief Increases the duration by the same step on every retry, up to the maximum.
+   * @examples
+   * LinearBackoff policy {.m_initial = 100ms, .m_step = 100ms, .m_max = 5s};
+   * @examples_end
+   */
+  struct LinearBackoff {
+    std::chrono::milliseconds m_initial; /**< Duration of the first retry. */
+    std::chrono::milliseconds m_step; /**< Increment for every subsequent retry. */
+    std::chrono::milliseconds m_max {std::chrono::milliseconds::max()}; /**< Upper bound for the duration. */
+    std::size_t m_attempt {0}; /**< Number of durations taken so far. */
+
+    /**
+     * @brief Get the next duration.
+     * @returns Duration to sleep before the next retry.
+     */
+    [[nodiscard]] std::chrono::milliseconds next();
+  };
+
+  /**
+   * @brief Multiplies the duration on every retry, up to the maximum.
+   * @examples
+   * ExponentialBackoff policy {.m_initial = 50ms, .m_multiplier = 2.0, .m_max = 30s};
+   * @examples_end
+   */
+  struct ExponentialBackoff {
+    std::chrono::milliseconds m_initial; /**< Duration of the first retry. */
+    double m_multiplier {2.0}; /**< Multiplier for every subsequent retry (must be at least 1, any larger value grows the duration by at least 1ms). */
+    std::chrono::milliseconds m_max; /**< Upper bound for the duration. */
+    std::chrono::milliseconds m_current {0}; /**< Last returned duration (zero before the first retry). */
+
+    /**
+     * @brief Get the next duration.
+     * @returns Duration to sleep before the next retry.
+     */
+    [[nodiscard]] std::chrono::milliseconds next();
+  };
+
+  /**
+   * @brief Randomizes the duration between the base and 3 times the previous duration, up to the maximum.
+   *
+   * Spreads out the retries of independent clients (the "decorrelated jitter" algorithm).
+   *
+   * @examples
+   * DecorrelatedJitterBackoff policy {.m_base = 100ms, .m_max = 10s};
+   * @examples_end
+   */
+  struct DecorrelatedJitterBackoff {
+    std::chrono::milliseconds m_base; /**< Lower bound and the first duration. */
+    std::chrono::milliseconds m_max; /**< Upper bound for the duration. */
+    std::chrono::milliseconds m_previous {0}; /**< Last returned duration (zero before the first retry). */
+    std::minstd_rand m_engine {}; /**< Random number generator (seeded on the first retry). */
+
+    /**
+     * @brief Get the next duration.
+     * @returns Duration to sleep before the next retry.
+     */
+    [[nodiscard]] std::chrono::milliseconds next();
+  };
+
+  /**
+   * @brief Uses the provided callable to calculate the duration from the attempt number.
+   * @examples
+   * CustomBackoff policy {.m_function = [](const std::size_t attempt) { return attempt < 10 ? 10ms : 1s; }};
+   * @examples_end
+   */
+  struct CustomBackoff {
+    std::function<std::chrono::milliseconds(std::size_t attempt)> m_function {}; /**< Function to be called with the attempt number (starting with 0). */
+    std::size_t m_attempt {0}; /**< Number of durations taken so far. */
+
+    /**
+     * @brief Get the next duration.
+     * @returns Duration to sleep before the next retry (non-positive values are raised to 1ms).
+     */
+    [[nodiscard]] std::chrono::milliseconds next();
+  };
+
+  /**
+   * @brief Any of the backoff policies.
+   */
+  using BackoffPolicy = std::variant<ListBackoff, ConstantBackoff, LinearBackoff, ExponentialBackoff, DecorrelatedJitterBackoff, CustomBackoff>;
+
+  /**
+   * @brief Take the next duration from the policy.
+   * @param policy Policy to advance.
+   * @returns Duration to sleep before the next retry.
+   */
+  [[nodiscard]] std::chrono::milliseconds takeNextDuration(BackoffPolicy &policy);
+
+  /**
+   * @brief Check if the policy only produces durations larger than 0.
+   * @param policy Policy to check.
+   * @returns True if the policy is valid, false otherwise.
+   */
+  [[nodiscard]] bool isValidBackoffPolicy(const BackoffPolicy &policy);
+}  // namespace display_device
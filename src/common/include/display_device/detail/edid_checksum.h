@@ -0,0 +1,38 @@
+/**
+ * @file src/common/include/display_device/detail/edid_checksum.h
+ * @brief Declarations for private EDID block checksum implementations.
+ */
+#pragma once
+
+// system includes
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace display_device::detail {
+  /**
+   * @brief A function that sums up all bytes of a single 128-byte EDID block modulo 256.
+   */
+  using EdidBlockSumFunction = std::uint8_t (*)(const std::byte *block);
+
+  /**
+   * @brief A named block sum implementation.
+   */
+  struct EdidBlockSumImpl {
+    std::string_view m_name; /**< Name of the implementation (for benchmarks and logs). */
+    EdidBlockSumFunction m_function; /**< The implementation itself. */
+  };
+
+  /**
+   * @brief Get the block sum implementations that are supported by the current CPU.
+   * @returns A list of implementations, where the scalar one is always first and the best one is last.
+   */
+  [[nodiscard]] std::span<const EdidBlockSumImpl> getSupportedEdidBlockSumImpls();
+
+  /**
+   * @brief Get the best block sum implementation for the current CPU (selected once at runtime).
+   * @returns Block sum function.
+   */
+  [[nodiscard]] EdidBlockSumFunction getEdidBlockSumFunction();
+}  // namespace display_device::detail
@@ -0,0 +1,41 @@
+/**
+ * @file src/common/include/display_device/detail/hash.h
+ * @brief Declarations for private non-cryptographic hashing helpers.
+ */
+#pragma once
+
+// system includes
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace display_device::detail {
+  /**
+   * @brief A 128-bit hash value.
+   */
+  struct Hash128 {
+    std::uint64_t m_low {}; /**< Lower 64 bits. */
+    std::uint64_t m_high {}; /**< Higher 64 bits. */
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const Hash128 &lhs, const Hash128 &rhs);
+  };
+
+  /**
+   * @brief Compute a fast non-cryptographic 128-bit hash (MurmurHash3 x64 variant).
+   * @param data Data to hash.
+   * @param seed Seed for the hash.
+   * @returns Hash value that is stable across platforms and runs.
+   * @warning Not suitable for anything security related.
+   */
+  [[nodiscard]] Hash128 hashBytes128(std::span<const std::byte> data, std::uint64_t seed = 0);
+
+  /**
+   * @brief Compute a fast non-cryptographic 64-bit hash.
+   * @param data Data to hash.
+   * @returns Lower 64 bits of the `hashBytes128`.
+   */
+  [[nodiscard]] std::uint64_t hashBytes64(std::span<const std::byte> data);
+}  // namespace display_device::detail
@@ -136,6 +136,22 @@ namespace nlohmann {
     }
   };
 
+  // Specialization for fixed strings, serialized the same way as regular strings.
+  template<std::size_t N>
+  struct adl_serializer<display_device::FixedString<N>> {
+    static void to_json(json &nlohmann_json_j, const display_device::FixedString<N> &nlohmann_json_t) {
+      nlohmann_json_j = nlohmann_json_t.view();
+    }
+
+    static void from_json(const json &nlohmann_json_j, display_device::FixedString<N> &nlohmann_json_t) {
+      const auto value {nlohmann_json_j.get<std::string_view>()};
+      if (value.size() > N) {
+        throw std::runtime_error("String \"" + std::string {value} + "\" exceeds the maximum length of " + std::to_string(N) + "!");
+      }
+      nlohmann_json_t = display_device::FixedString<N> {value};
+    }
+  };
+
   // Specialization for chrono duration.
   template<class Rep, class Period>
   struct adl_serializer<std::chrono::duration<Rep, Period>> {
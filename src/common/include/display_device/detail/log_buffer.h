@@ -0,0 +1,131 @@
+/**
+ * @file src/common/include/display_device/detail/log_buffer.h
+ * @brief Declarations for the small-buffer log line storage.
+ */
+#pragma once
+
+// system includes
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace display_device::detail {
+  /**
+   * @brief A text buffer that is stored inline and only spills to the heap for long lines.
+   */
+  class LogBuffer {
+  public:
+    static constexpr std::size_t INLINE_CAPACITY {256}; /**< Number of characters that can be stored without the heap allocation. */
+
+    /**
+     * @brief Default constructor.
+     */
+    LogBuffer() = default;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    LogBuffer(const LogBuffer &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    LogBuffer &operator=(const LogBuffer &) = delete;
+
+    /**
+     * @brief Append the text to the buffer.
+     * @param value Text to append.
+     */
+    void append(const std::string_view value) {
+      if (m_spilled) {
+        m_heap.append(value);
+        return;
+      }
+
+      if (value.size() <= INLINE_CAPACITY - m_size) {
+        std::memcpy(m_inline.data() + m_size, value.data(), value.size());
+        m_size += value.size();
+        return;
+      }
+
+      m_heap.reserve(2 * (m_size + value.size()));
+      m_heap.append(m_inline.data(), m_size).append(value);
+      m_spilled = true;
+    }
+
+    /**
+     * @brief Append the number to the buffer, formatted the same way as the default std::ostream would.
+     * @param value Number to append.
+     */
+    template<class T>
+      requires std::is_arithmetic_v<T>
+    void appendNumber(const T value) {
+      std::array<char, 64> buffer {};
+      std::to_chars_result result;
+      if constexpr (std::is_floating_point_v<T>) {
+        result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::general, 6);
+      } else {
+        result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+      }
+      append({buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data())});
+    }
+
+    /**
+     * @brief Get the buffered text.
+     * @returns View that is valid until the next append.
+     */
+    [[nodiscard]] std::string_view view() const {
+      return m_spilled ? std::string_view {m_heap} : std::string_view {m_inline.data(), m_size};
+    }
+
+    /**
+     * @brief Check if the text no longer fits into the inline storage.
+     * @returns True if the heap is used, false otherwise.
+     */
+    [[nodiscard]] bool isSpilled() const {
+      return m_spilled;
+    }
+
+  private:
+    std::array<char, INLINE_CAPACITY> m_inline; /**< Inline storage (intentionally left uninitialized). */
+    std::size_t m_size {0}; /**< Number of used characters in the inline storage. */
+    std::string m_heap; /**< Storage for the long lines. */
+    bool m_spilled {false}; /**< True if the heap storage is used. */
+  };
+
+  /**
+   * @brief A stream buffer that writes into the LogBuffer, so that the types with
+   *        only the std::ostream `operator<<` overload can still be logged.
+   */
+  class LogStreamBuffer: public std::streambuf {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param buffer Buffer to write into.
+     */
+    explicit LogStreamBuffer(LogBuffer &buffer):
+        m_buffer {buffer} {}
+
+  protected:
+    int_type overflow(const int_type ch) override {
+      if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        const char value {traits_type::to_char_type(ch)};
+        m_buffer.append({&value, 1});
+      }
+      return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char *data, const std::streamsize size) override {
+      m_buffer.append({data, static_cast<std::size_t>(size)});
+      return size;
+    }
+
+  private:
+    LogBuffer &m_buffer;
+  };
+}  // namespace display_device::detail
@@ -0,0 +1,116 @@
+/**
+ * @file src/common/include/display_device/detail/mpsc_ring_buffer.h
+ * @brief Declarations for the bounded lock-free MPSC ring buffer.
+ */
+#pragma once
+
+// system includes
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+namespace display_device::detail {
+  /**
+   * @brief A bounded lock-free ring buffer for multiple producers and a single consumer.
+   *
+   * Every slot has a sequence number that tells whether it is ready to be written
+   * to or read from (the "bounded MPMC queue" by Dmitry Vyukov, reduced to a single consumer).
+   * Producers only contend on the enqueue position, the consumer never blocks them.
+   *
+   * @tparam T Default constructible and move assignable value type.
+   */
+  template<class T>
+  class MpscRingBuffer {
+  public:
+    /**
+     * @brief Default constructor.
+     * @param capacity Number of slots, must be a power of 2 and at least 2.
+     */
+    explicit MpscRingBuffer(const std::size_t capacity):
+        m_mask {capacity - 1},
+        m_slots {std::make_unique<Slot[]>(capacity)} {
+      if (capacity < 2 || !std::has_single_bit(capacity)) {
+        throw std::logic_error {"MpscRingBuffer capacity must be a power of 2!"};
+      }
+
+      for (std::size_t i {0}; i < capacity; ++i) {
+        m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    /**
+     * @brief Try to push the value to the buffer (can be called by any thread).
+     * @param value Value to be moved into the buffer. It is left untouched if the buffer is full.
+     * @returns True if the value was pushed, false if the buffer is full.
+     */
+    bool tryPush(T &value) {
+      std::size_t position {m_enqueue_position.load(std::memory_order_relaxed)};
+      while (true) {
+        Slot &slot {m_slots[position & m_mask]};
+        const std::size_t sequence {slot.m_sequence.load(std::memory_order_acquire)};
+        const auto diff {static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position)};
+
+        if (diff == 0) {
+          if (m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+            slot.m_value = std::move(value);
+            slot.m_sequence.store(position + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (diff < 0) {
+          // The consumer has not freed this slot yet
+          return false;
+        } else {
+          position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /**
+     * @brief Try to pop the value from the buffer (must only be called by the consumer thread).
+     * @param value Destination for the popped value.
+     * @returns True if the value was popped, false if the buffer is empty.
+     */
+    bool tryPop(T &value) {
+      Slot &slot {m_slots[m_dequeue_position & m_mask]};
+      if (slot.m_sequence.load(std::memory_order_acquire) != m_dequeue_position + 1) {
+        return false;
+      }
+
+      value = std::move(slot.m_value);
+      slot.m_sequence.store(m_dequeue_position + m_mask + 1, std::memory_order_release);
+      ++m_dequeue_position;
+      return true;
+    }
+
+    /**
+     * @brief Get the total number of values that were (or are being) pushed to the buffer.
+     * @note Values are popped in the same order, so this can be compared against the popped value count.
+     */
+    [[nodiscard]] std::size_t getEnqueuedCount() const {
+      return m_enqueue_position.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the number of slots in the buffer.
+     */
+    [[nodiscard]] std::size_t getCapacity() const {
+      return m_mask + 1;
+    }
+
+  private:
+    static constexpr std::size_t CACHE_LINE_SIZE {64};
+
+    struct Slot {
+      std::atomic<std::size_t> m_sequence;
+      T m_value;
+    };
+
+    std::size_t m_mask; /**< Capacity - 1, for the cheap modulo. */
+    std::unique_ptr<Slot[]> m_slots; /**< The ring itself. */
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_enqueue_position {0}; /**< Shared by the producers. */
+    alignas(CACHE_LINE_SIZE) std::size_t m_dequeue_position {0}; /**< Owned by the consumer. */
+  };
+}  // namespace display_device::detail
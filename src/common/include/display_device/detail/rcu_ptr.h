@@ -0,0 +1,186 @@
+/**
+ * @file src/common/include/display_device/detail/rcu_ptr.h
+ * @brief Declarations for the pointer with the lock-free reads and the deferred reclamation.
+ */
+#pragma once
+
+// system includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace display_device::detail {
+  /**
+   * @brief An immutable value that is read without locks and replaced as a whole (read-copy-update).
+   *
+   * Readers register in one of the two counters selected by the current epoch and only then
+   * load the pointer. The writer publishes the new value and flips the epoch twice, each time
+   * waiting for the counter of the previous epoch to drain. After that no reader can still see
+   * the old value, so it can be destroyed. Readers never wait, only the (serialized) writers do.
+   *
+   * If the writer itself holds a read guard (e.g. it is updating the value from within a callback
+   * that was invoked while reading), waiting would never end. The old value is retired instead
+   * and destroyed by the next update that is able to wait for the readers.
+   *
+   * @tparam T Value type.
+   */
+  template<class T>
+  class RcuPtr {
+  public:
+    /**
+     * @brief Keeps the value that was current at the time of the construction alive.
+     */
+    class ReadGuard {
+    public:
+      /**
+       * @brief Register the reader and load the current value.
+       * @param ptr Pointer to be read.
+       */
+      explicit ReadGuard(const RcuPtr &ptr):
+          m_ptr {ptr} {
+        while (true) {
+          m_epoch = ptr.m_epoch.load();
+          ptr.m_readers[m_epoch].m_count.fetch_add(1);
+          if (ptr.m_epoch.load() == m_epoch) {
+            break;
+          }
+
+          // The writer has flipped the epoch in the meantime, so it might have already seen this counter drained
+          ptr.m_readers[m_epoch].m_count.fetch_sub(1);
+        }
+        m_value = ptr.m_value.load();
+        ++t_read_depth;
+      }
+
+      /**
+       * @brief Unregister the reader.
+       */
+      ~ReadGuard() {
+        --t_read_depth;
+        m_ptr.m_readers[m_epoch].m_count.fetch_sub(1);
+      }
+
+      /**
+       * @brief Deleted copy constructor.
+       */
+      ReadGuard(const ReadGuard &) = delete;
+
+      /**
+       * @brief Deleted copy operator.
+       */
+      ReadGuard &operator=(const ReadGuard &) = delete;
+
+      /**
+       * @brief Get the value.
+       */
+      const T &operator*() const {
+        return *m_value;
+      }
+
+      /**
+       * @brief Access the value.
+       */
+      const T *operator->() const {
+        return m_value;
+      }
+
+    private:
+      const RcuPtr &m_ptr;
+      std::size_t m_epoch {0};
+      const T *m_value {nullptr};
+    };
+
+    /**
+     * @brief Default constructor.
+     * @param value Initial value (must not be nullptr).
+     */
+    explicit RcuPtr(std::unique_ptr<const T> value):
+        m_value {value.release()} {
+    }
+
+    /**
+     * @brief Destroy the current value (there must be no readers left).
+     */
+    ~RcuPtr() {
+      delete m_value.load();
+    }
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    RcuPtr(const RcuPtr &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    RcuPtr &operator=(const RcuPtr &) = delete;
+
+    /**
+     * @brief Get the current value for reading (can be called by any thread).
+     * @returns Guard that keeps the value alive.
+     */
+    [[nodiscard]] ReadGuard read() const {
+      return ReadGuard {*this};
+    }
+
+    /**
+     * @brief Check if the calling thread holds a read guard.
+     * @returns True if reading, false otherwise.
+     * @note Tracked per value type, so the read guards of other pointers of the same type count as well.
+     */
+    [[nodiscard]] static bool isReadByCurrentThread() {
+      return t_read_depth > 0;
+    }
+
+    /**
+     * @brief Publish the new value and wait until the previous one is no longer read.
+     * @param make_value Function that creates the new value from the current one.
+     * @returns The previous value that is safe to be destroyed, or nullptr if the calling thread
+     *          is reading (the previous value is then destroyed by a later update).
+     * @note The updates are serialized, so the current value cannot change during the `make_value` call.
+     */
+    template<class FunctionT>
+    std::unique_ptr<const T> update(FunctionT &&make_value) {
+      std::lock_guard lock {m_writer_mutex};
+      std::unique_ptr<const T> value {std::forward<FunctionT>(make_value)(std::as_const(*m_value.load()))};
+      std::unique_ptr<const T> previous {m_value.exchange(value.release())};
+      if (isReadByCurrentThread()) {
+        m_retired.push_back(std::move(previous));
+        return nullptr;
+      }
+
+      for (int i {0}; i < 2; ++i) {
+        const auto epoch {m_epoch.load()};
+        m_epoch.store(epoch ^ 1);
+        while (m_readers[epoch].m_count.load() != 0) {
+          std::this_thread::yield();
+        }
+      }
+
+      // The retired values were replaced before the epochs were flipped, so they are no longer read either
+      m_retired.clear();
+      return previous;
+    }
+
+  private:
+    static constexpr std::size_t CACHE_LINE_SIZE {64};
+
+    struct alignas(CACHE_LINE_SIZE) ReaderCounter {
+      std::atomic<std::size_t> m_count {0};
+    };
+
+    // All of the operations are sequentially consistent, so that a reader that has loaded the old
+    // value is either seen by the writer in the counter or it sees the flipped epoch and retries.
+    std::atomic<const T *> m_value; /**< The current value. */
+    std::atomic<std::size_t> m_epoch {0}; /**< Index of the counter for the new readers. */
+    mutable std::array<ReaderCounter, 2> m_readers; /**< Number of the readers per epoch. */
+    std::mutex m_writer_mutex; /**< Serializes the updates (readers do not use it). */
+    std::vector<std::unique_ptr<const T>> m_retired; /**< Previous values that might still be read (guarded by the writer mutex). */
+    static inline thread_local std::size_t t_read_depth {0}; /**< Number of the read guards held by the current thread. */
+  };
+}  // namespace display_device::detail
@@ -0,0 +1,33 @@
+/**
+ * @file src/common/include/display_device/detail/timestamp_formatter.h
+ * @brief Declarations for the log timestamp formatting helper.
+ */
+#pragma once
+
+// system includes
+#include <array>
+#include <chrono>
+#include <string_view>
+
+namespace display_device::detail {
+  /**
+   * @brief A buffer that is large enough to fit any timestamp produced by `formatTimestamp`.
+   */
+  using TimestampBuffer = std::array<char, 48>;
+
+  /**
+   * @brief Format the time as a local "[%Y-%m-%d %H:%M:%S.mmm] " timestamp.
+   *
+   * The part up to the seconds is cached per thread and is only re-formatted when
+   * the second changes, so that most of the calls only need to patch in the milliseconds.
+   *
+   * @param time Time to format.
+   * @param buffer Buffer to write the timestamp into.
+   * @returns View into the buffer.
+   * @examples
+   * TimestampBuffer buffer;
+   * const auto timestamp {formatTimestamp(std::chrono::system_clock::now(), buffer)};  // "[2024-07-01 12:34:56.789] "
+   * @examples_end
+   */
+  [[nodiscard]] std::string_view formatTimestamp(std::chrono::system_clock::time_point time, TimestampBuffer &buffer);
+}  // namespace display_device::detail
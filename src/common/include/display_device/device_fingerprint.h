@@ -0,0 +1,69 @@
+/**
+ * @file src/common/include/display_device/device_fingerprint.h
+ * @brief Declarations for the stable device fingerprint.
+ */
+#pragma once
+
+// system includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace display_device {
+  /**
+   * @brief A stable 128-bit device identifier derived from the EDID and the connector identity.
+   *
+   * Uses a fast non-cryptographic hash, so it is cheap enough to be computed for
+   * every path on every query. The value is stable across platforms and runs.
+   */
+  class DeviceFingerprint {
+  public:
+    /**
+     * @brief Create the fingerprint.
+     * @param edid Raw EDID data (can be empty).
+     * @param connector_id Stable identity of the connector/port the device is attached to (can be empty).
+     * @returns Fingerprint of the device.
+     * @examples
+     * const auto fingerprint {DeviceFingerprint::create(edid, "DISPLAY\\ACI27EC\\5&4FD2DE4")};
+     * @examples_end
+     */
+    [[nodiscard]] static DeviceFingerprint create(std::span<const std::byte> edid, std::span<const std::byte> connector_id);
+
+    /**
+     * @brief Create the fingerprint from a textual connector identity.
+     * @see create for more details.
+     */
+    [[nodiscard]] static DeviceFingerprint create(std::span<const std::byte> edid, std::string_view connector_id);
+
+    /**
+     * @brief Get the fingerprint bytes.
+     * @returns Bytes in the big-endian (UUID) order.
+     */
+    [[nodiscard]] std::array<std::byte, 16> getBytes() const;
+
+    /**
+     * @brief Get the string representation.
+     * @returns Fingerprint formatted as a UUID in braces, e.g. "{01234567-89ab-8def-8123-456789abcdef}".
+     */
+    [[nodiscard]] std::string toString() const;
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const DeviceFingerprint &lhs, const DeviceFingerprint &rhs);
+
+  private:
+    /**
+     * @brief A private constructor to ensure that only the created fingerprints exist.
+     * @param high Higher 64 bits.
+     * @param low Lower 64 bits.
+     */
+    DeviceFingerprint(std::uint64_t high, std::uint64_t low);
+
+    std::uint64_t m_high; /**< Higher 64 bits. */
+    std::uint64_t m_low; /**< Lower 64 bits. */
+  };
+}  // namespace display_device
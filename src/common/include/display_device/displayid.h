@@ -0,0 +1,234 @@
+/**
+ * @file src/common/include/display_device/displayid.h
+ * @brief Declarations for the zero-copy DisplayID 2.0 decoder.
+ */
+#pragma once
+
+// system includes
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+// local includes
+#include "edid.h"
+
+namespace display_device {
+  /**
+   * @brief A type VII detailed timing from the DisplayID 2.0 data block.
+   */
+  struct DisplayIdDetailedTiming {
+    EdidDetailedTiming m_timing {}; /**< Decoded timing. The pixel clock is in kHz, as in EDID. */
+    bool m_preferred {}; /**< Indicates whether the timing is marked as preferred. */
+    std::uint8_t m_aspect_ratio {}; /**< Aspect ratio code (0 = 1:1, 1 = 5:4, 2 = 4:3, ... 8 = undefined). */
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const DisplayIdDetailedTiming &lhs, const DisplayIdDetailedTiming &rhs);
+  };
+
+  /**
+   * @brief A type VIII enumerated timing code from the DisplayID 2.0 data block.
+   */
+  struct DisplayIdEnumeratedTiming {
+    /**
+     * @brief Standard defining the timing code.
+     */
+    enum class CodeType : std::uint8_t {
+      Dmt = 0,  ///< VESA DMT ID
+      Vic = 1,  ///< CTA-861 VIC
+      HdmiVic = 2  ///< HDMI VIC
+    };
+
+    CodeType m_code_type {}; /**< Standard defining the timing code. */
+    std::uint16_t m_code {}; /**< Timing code. */
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const DisplayIdEnumeratedTiming &lhs, const DisplayIdEnumeratedTiming &rhs);
+  };
+
+  /**
+   * @brief Tiled display topology from the DisplayID 2.0 data block.
+   *
+   * All tiles of the same physical display share the vendor ID, product code
+   * and serial number, which can be used to group them.
+   */
+  struct DisplayIdTiledTopology {
+    bool m_single_enclosure {}; /**< Indicates whether all tiles are in a single physical enclosure. */
+    std::uint8_t m_horizontal_tiles {}; /**< Number of horizontal tiles. */
+    std::uint8_t m_vertical_tiles {}; /**< Number of vertical tiles. */
+    std::uint8_t m_horizontal_location {}; /**< Zero-based horizontal location of this tile. */
+    std::uint8_t m_vertical_location {}; /**< Zero-based vertical location of this tile. */
+    Resolution m_tile_resolution {}; /**< Native resolution of this tile. */
+    std::uint32_t m_vendor_id {}; /**< IEEE OUI of the display vendor. */
+    std::uint16_t m_product_code {}; /**< Product code of the tiled display. */
+    std::uint32_t m_serial_number {}; /**< Serial number of the tiled display. */
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const DisplayIdTiledTopology &lhs, const DisplayIdTiledTopology &rhs);
+  };
+
+  /**
+   * @brief A non-owning, allocation-free view over the DisplayID 2.0 section embedded in an EDID extension block.
+   * @warning The underlying data must outlive the view.
+   */
+  class DisplayIdView {
+  public:
+    static constexpr std::uint8_t EXTENSION_TAG {0x70}; /**< Tag of the EDID extension block containing DisplayID. */
+    static constexpr std::uint8_t TYPE_VII_TIMING_TAG {0x22}; /**< Tag of the type VII detailed timing data block. */
+    static constexpr std::uint8_t TYPE_VIII_TIMING_TAG {0x23}; /**< Tag of the type VIII enumerated timing code data block. */
+    static constexpr std::uint8_t TILED_TOPOLOGY_TAG {0x28}; /**< Tag of the tiled display topology data block. */
+
+    /**
+     * @brief Create the view if the extension block contains a valid DisplayID 2.0 section.
+     * @param block EDID extension block.
+     * @returns View for the section or empty optional if the block is not a valid DisplayID 2.0 block.
+     * @examples
+     * const auto view {DisplayIdView::create(edid_view.getBlock(1))};
+     * @examples_end
+     */
+    [[nodiscard]] static std::optional<DisplayIdView> create(std::span<const std::byte> block);
+
+    /**
+     * @brief Invoke the callback for every valid DisplayID 2.0 extension block in the EDID.
+     * @param edid View of the EDID data.
+     * @param callback Callback with a `void(const DisplayIdView &)` signature.
+     * @examples
+     * DisplayIdView::forEachInEdid(edid_view, [](const DisplayIdView &view) {
+     *   const auto topology {view.getTiledTopology()};
+     * });
+     * @examples_end
+     */
+    template<class Callback>
+    static void forEachInEdid(const EdidView &edid, Callback &&callback) {
+      for (std::size_t index {1}; index < edid.getBlockCount(); ++index) {
+        const auto block {edid.getBlock(index)};
+        if (std::to_integer<std::uint8_t>(block[0]) != EXTENSION_TAG || !edid.isBlockValid(index)) {
+          continue;
+        }
+
+        if (const auto view {create(block)}; view) {
+          callback(*view);
+        }
+      }
+    }
+
+    /**
+     * @brief Get the DisplayID structure revision.
+     * @returns Revision (the version is always 2).
+     */
+    [[nodiscard]] std::uint8_t getRevision() const;
+
+    /**
+     * @brief Get the display product primary use case.
+     * @returns Use case code (0 = extension section, 1 = test structure, 2 = generic display, ...).
+     */
+    [[nodiscard]] std::uint8_t getProductType() const;
+
+    /**
+     * @brief Get the tiled display topology.
+     * @returns Topology from the first tiled display topology data block or empty optional if there is none.
+     */
+    [[nodiscard]] std::optional<DisplayIdTiledTopology> getTiledTopology() const;
+
+    /**
+     * @brief Invoke the callback for every data block in the section.
+     * @param callback Callback with a `void(std::uint8_t tag, std::uint8_t revision, std::span<const std::byte> payload)` signature.
+     * @note Payload does not include the data block header.
+     */
+    template<class Callback>
+    void forEachDataBlock(Callback &&callback) const {
+      std::size_t offset {0};
+      while (offset + DATA_BLOCK_HEADER_SIZE <= m_payload.size()) {
+        const auto tag {std::to_integer<std::uint8_t>(m_payload[offset])};
+        const auto revision {std::to_integer<std::uint8_t>(m_payload[offset + 1])};
+        const auto length {std::to_integer<std::size_t>(m_payload[offset + 2])};
+        if (tag == 0 && length == 0) {
+          // Padding follows after the last data block
+          break;
+        }
+
+        offset += DATA_BLOCK_HEADER_SIZE;
+        if (offset + length > m_payload.size()) {
+          break;
+        }
+
+        callback(tag, revision, m_payload.subspan(offset, length));
+        offset += length;
+      }
+    }
+
+    /**
+     * @brief Invoke the callback for every type VII detailed timing.
+     * @param callback Callback with a `void(const DisplayIdDetailedTiming &)` signature.
+     */
+    template<class Callback>
+    void forEachDetailedTiming(Callback &&callback) const {
+      forEachDataBlock([&callback](const std::uint8_t tag, const std::uint8_t revision, const std::span<const std::byte> payload) {
+        if (tag != TYPE_VII_TIMING_TAG) {
+          return;
+        }
+
+        const std::size_t descriptor_size {TYPE_VII_DESCRIPTOR_SIZE + ((revision >> 4) & 0x07)};
+        for (std::size_t offset {0}; offset + descriptor_size <= payload.size(); offset += descriptor_size) {
+          callback(decodeDetailedTiming(payload.subspan(offset, TYPE_VII_DESCRIPTOR_SIZE)));
+        }
+      });
+    }
+
+    /**
+     * @brief Invoke the callback for every type VIII enumerated timing code.
+     * @param callback Callback with a `void(const DisplayIdEnumeratedTiming &)` signature.
+     */
+    template<class Callback>
+    void forEachEnumeratedTiming(Callback &&callback) const {
+      forEachDataBlock([&callback](const std::uint8_t tag, const std::uint8_t revision, const std::span<const std::byte> payload) {
+        if (tag != TYPE_VIII_TIMING_TAG) {
+          return;
+        }
+
+        const auto code_type {static_cast<DisplayIdEnumeratedTiming::CodeType>(revision >> 6)};
+        const std::size_t code_size {(revision & 0x08) != 0 ? 2u : 1u};
+        for (std::size_t offset {0}; offset + code_size <= payload.size(); offset += code_size) {
+          std::uint16_t code {std::to_integer<std::uint16_t>(payload[offset])};
+          if (code_size == 2) {
+            code |= static_cast<std::uint16_t>(std::to_integer<std::uint16_t>(payload[offset + 1]) << 8);
+          }
+          callback(DisplayIdEnumeratedTiming {code_type, code});
+        }
+      });
+    }
+
+    /**
+     * @brief Decode the 20-byte type VII detailed timing descriptor.
+     * @param descriptor Descriptor data.
+     * @returns Decoded timing.
+     */
+    [[nodiscard]] static DisplayIdDetailedTiming decodeDetailedTiming(std::span<const std::byte> descriptor);
+
+    /**
+     * @brief Decode the tiled display topology data block payload.
+     * @param payload Payload of the data block.
+     * @returns Decoded topology or empty optional if the payload is too small.
+     */
+    [[nodiscard]] static std::optional<DisplayIdTiledTopology> decodeTiledTopology(std::span<const std::byte> payload);
+
+  private:
+    static constexpr std::size_t DATA_BLOCK_HEADER_SIZE {3};
+    static constexpr std::size_t TYPE_VII_DESCRIPTOR_SIZE {20};
+
+    /**
+     * @brief A private constructor to ensure that only valid views are created.
+     * @param section Validated section data (header included, checksum excluded).
+     */
+    explicit DisplayIdView(std::span<const std::byte> section);
+
+    std::span<const std::byte> m_section; /**< Section header and data blocks. */
+    std::span<const std::byte> m_payload; /**< Data blocks only. */
+  };
+}  // namespace display_device
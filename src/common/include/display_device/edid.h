@@ -0,0 +1,462 @@
+/**
+ * @file src/common/include/display_device/edid.h
+ * @brief Declarations for the zero-copy EDID decoder.
+ */
+#pragma once
+
+// system includes
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+// local includes
+#include "detail/edid_checksum.h"
+#include "types.h"
+
+namespace display_device {
+  /**
+   * @brief A detailed timing descriptor (DTD) decoded from the EDID or one of its extensions.
+   */
+  struct EdidDetailedTiming {
+    std::uint32_t m_pixel_clock_khz {}; /**< Pixel clock in kHz. */
+    std::uint16_t m_h_active {}; /**< Horizontal addressable pixels. */
+    std::uint16_t m_h_blanking {}; /**< Horizontal blanking pixels. */
+    std::uint16_t m_h_sync_offset {}; /**< Horizontal front porch in pixels. */
+    std::uint16_t m_h_sync_width {}; /**< Horizontal sync pulse width in pixels. */
+    std::uint16_t m_v_active {}; /**< Vertical addressable lines. */
+    std::uint16_t m_v_blanking {}; /**< Vertical blanking lines. */
+    std::uint16_t m_v_sync_offset {}; /**< Vertical front porch in lines. */
+    std::uint16_t m_v_sync_width {}; /**< Vertical sync pulse width in lines. */
+    bool m_interlaced {}; /**< Indicates whether the timing is interlaced. */
+
+    /**
+     * @brief Get the refresh rate of the timing.
+     * @returns Refresh rate in a "pixel clock / total pixels" form.
+     */
+    [[nodiscard]] Rational getRefreshRate() const;
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const EdidDetailedTiming &lhs, const EdidDetailedTiming &rhs);
+  };
+
+  /**
+   * @brief A short video descriptor (SVD) from the CTA-861 video data block.
+   */
+  struct EdidVideoDescriptor {
+    std::uint8_t m_vic {}; /**< Video identification code as defined in CTA-861. */
+    bool m_native {}; /**< Indicates whether the sink marked this format as native. */
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const EdidVideoDescriptor &lhs, const EdidVideoDescriptor &rhs);
+  };
+
+  /**
+   * @brief A short audio descriptor (SAD) from the CTA-861 audio data block.
+   */
+  struct EdidAudioDescriptor {
+    std::uint8_t m_format {}; /**< Audio format code (1 = LPCM, 2 = AC-3, etc.). */
+    std::uint8_t m_max_channels {}; /**< Maximum number of channels. */
+    std::uint8_t m_sample_rates {}; /**< Bitmask of supported sample rates (bit 0 = 32kHz ... bit 6 = 192kHz). */
+    std::uint8_t m_format_details {}; /**< Format dependent byte (bit depths for LPCM, max bitrate for others). */
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const EdidAudioDescriptor &lhs, const EdidAudioDescriptor &rhs);
+  };
+
+  /**
+   * @brief HDR static metadata from the CTA-861 extended data block.
+   */
+  struct EdidHdrStaticMetadata {
+    /**
+     * @brief Electro-optical transfer functions that can be advertised by the sink.
+     */
+    enum class Eotf : std::uint8_t {
+      TraditionalSdr = 0x01,  ///< Traditional gamma - SDR luminance range
+      TraditionalHdr = 0x02,  ///< Traditional gamma - HDR luminance range
+      SmpteSt2084 = 0x04,  ///< SMPTE ST 2084 (PQ)
+      Hlg = 0x08  ///< Hybrid Log-Gamma
+    };
+
+    std::uint8_t m_eotfs {}; /**< Bitmask of the supported EOTFs. */
+    std::uint8_t m_metadata_descriptors {}; /**< Bitmask of the supported static metadata descriptors. */
+    std::optional<std::uint8_t> m_max_luminance {}; /**< Desired content max luminance (coded value). */
+    std::optional<std::uint8_t> m_max_frame_avg_luminance {}; /**< Desired content max frame-average luminance (coded value). */
+    std::optional<std::uint8_t> m_min_luminance {}; /**< Desired content min luminance (coded value). */
+
+    /**
+     * @brief Check if the EOTF is supported by the sink.
+     * @param eotf EOTF to check.
+     * @returns True if supported, false otherwise.
+     */
+    [[nodiscard]] bool isEotfSupported(Eotf eotf) const;
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const EdidHdrStaticMetadata &lhs, const EdidHdrStaticMetadata &rhs);
+  };
+
+  /**
+   * @brief A non-owning, allocation-free view over the raw EDID data.
+   *
+   * The view only validates the base block on creation. Extension blocks
+   * that have a bad checksum or are missing from the data are skipped
+   * when decoding.
+   *
+   * @warning The underlying data must outlive the view.
+   */
+  class EdidView {
+  public:
+    static constexpr std::size_t BLOCK_SIZE {128}; /**< Size of the single EDID block. */
+    static constexpr std::uint8_t CTA_EXTENSION_TAG {0x02}; /**< Tag of the CTA-861 extension block. */
+
+    /**
+     * @brief Create the view if the base block is valid.
+     * @param data Data to create the view for.
+     * @returns View for the data or empty optional if the base block is invalid.
+     * @examples
+     * const std::vector<std::byte> data { ... };
+     * if (const auto view {EdidView::create(data)}; view) {
+     *   const auto timing {view->getPreferredTiming()};
+     * }
+     * @examples_end
+     */
+    [[nodiscard]] static std::optional<EdidView> create(std::span<const std::byte> data);
+
+    /**
+     * @brief Get the number of blocks that are available in the data.
+     * @returns Number of blocks (base block included), limited by the data size.
+     */
+    [[nodiscard]] std::size_t getBlockCount() const;
+
+    /**
+     * @brief Get the block data.
+     * @param index Index of the block.
+     * @returns Data of the block or an empty span if the index is out of range.
+     */
+    [[nodiscard]] std::span<const std::byte> getBlock(std::size_t index) const;
+
+    /**
+     * @brief Check if the block has a valid checksum.
+     * @param index Index of the block.
+     * @returns True if the block exists and has a valid checksum, false otherwise.
+     */
+    [[nodiscard]] bool isBlockValid(std::size_t index) const;
+
+    /**
+     * @brief Get the decoded manufacturer ID.
+     * @returns Three uppercase characters, if the data is sane.
+     */
+    [[nodiscard]] constexpr std::array<char, 3> getManufacturerId() const {
+      return decodeManufacturerId(m_data);
+    }
+
+    /**
+     * @brief Get the product code.
+     * @returns Product code.
+     */
+    [[nodiscard]] constexpr std::uint16_t getProductCode() const {
+      return decodeProductCode(m_data);
+    }
+
+    /**
+     * @brief Get the serial number.
+     * @returns Serial number.
+     */
+    [[nodiscard]] constexpr std::uint32_t getSerialNumber() const {
+      return decodeSerialNumber(m_data);
+    }
+
+    /**
+     * @brief Get the first detailed timing of the base block, which is the preferred one.
+     * @returns Preferred timing or empty optional if there is none.
+     */
+    [[nodiscard]] std::optional<EdidDetailedTiming> getPreferredTiming() const;
+
+    /**
+     * @brief Get the HDR static metadata from the first CTA-861 extension block that has it.
+     * @returns HDR static metadata or empty optional if there is none.
+     */
+    [[nodiscard]] std::optional<EdidHdrStaticMetadata> getHdrStaticMetadata() const;
+
+    /**
+     * @brief Invoke the callback for every detailed timing in the base and CTA-861 extension blocks.
+     * @param callback Callback with a `void(const EdidDetailedTiming &)` signature.
+     * @examples
+     * view.forEachDetailedTiming([](const EdidDetailedTiming &timing) {
+     *   // Do something with timing
+     * });
+     * @examples_end
+     */
+    template<class Callback>
+    void forEachDetailedTiming(Callback &&callback) const {
+      for (std::size_t offset {BASE_DESCRIPTORS_OFFSET}; offset + DESCRIPTOR_SIZE <= CHECKSUM_OFFSET; offset += DESCRIPTOR_SIZE) {
+        if (const auto timing {decodeDetailedTiming(m_data.subspan(offset, DESCRIPTOR_SIZE))}; timing) {
+          callback(*timing);
+        }
+      }
+
+      forEachCtaBlock([&callback](const std::span<const std::byte> block) {
+        const std::size_t dtd_offset {std::to_integer<std::size_t>(block[2])};
+        if (dtd_offset < CTA_DATA_BLOCKS_OFFSET) {
+          return;
+        }
+
+        for (std::size_t offset {dtd_offset}; offset + DESCRIPTOR_SIZE <= CHECKSUM_OFFSET; offset += DESCRIPTOR_SIZE) {
+          const auto timing {decodeDetailedTiming(block.subspan(offset, DESCRIPTOR_SIZE))};
+          if (!timing) {
+            // Padding follows after the last descriptor
+            break;
+          }
+          callback(*timing);
+        }
+      });
+    }
+
+    /**
+     * @brief Invoke the callback for every data block in the CTA-861 extension blocks.
+     * @param callback Callback with a `void(std::uint8_t tag, std::span<const std::byte> payload)` signature.
+     * @note Payload does not include the data block header byte.
+     */
+    template<class Callback>
+    void forEachCtaDataBlock(Callback &&callback) const {
+      forEachCtaBlock([&callback](const std::span<const std::byte> block) {
+        const std::size_t dtd_offset {std::min(std::to_integer<std::size_t>(block[2]), CHECKSUM_OFFSET)};
+        for (std::size_t offset {CTA_DATA_BLOCKS_OFFSET}; offset < dtd_offset;) {
+          const auto header {std::to_integer<std::uint8_t>(block[offset])};
+          const std::size_t length {header & 0x1Fu};
+          if (offset + 1 + length > dtd_offset) {
+            // Malformed data block collection
+            break;
+          }
+
+          callback(static_cast<std::uint8_t>(header >> 5), block.subspan(offset + 1, length));
+          offset += 1 + length;
+        }
+      });
+    }
+
+    /**
+     * @brief Invoke the callback for every short video descriptor in the CTA-861 extension blocks.
+     * @param callback Callback with a `void(const EdidVideoDescriptor &)` signature.
+     */
+    template<class Callback>
+    void forEachVideoDescriptor(Callback &&callback) const {
+      forEachCtaDataBlock([&callback](const std::uint8_t tag, const std::span<const std::byte> payload) {
+        if (tag != CTA_VIDEO_TAG) {
+          return;
+        }
+
+        for (const auto byte : payload) {
+          if (const auto descriptor {decodeVideoDescriptor(byte)}; descriptor) {
+            callback(*descriptor);
+          }
+        }
+      });
+    }
+
+    /**
+     * @brief Invoke the callback for every short audio descriptor in the CTA-861 extension blocks.
+     * @param callback Callback with a `void(const EdidAudioDescriptor &)` signature.
+     */
+    template<class Callback>
+    void forEachAudioDescriptor(Callback &&callback) const {
+      forEachCtaDataBlock([&callback](const std::uint8_t tag, const std::span<const std::byte> payload) {
+        if (tag != CTA_AUDIO_TAG) {
+          return;
+        }
+
+        for (std::size_t offset {0}; offset + AUDIO_DESCRIPTOR_SIZE <= payload.size(); offset += AUDIO_DESCRIPTOR_SIZE) {
+          callback(decodeAudioDescriptor(payload.subspan(offset, AUDIO_DESCRIPTOR_SIZE)));
+        }
+      });
+    }
+
+    /**
+     * @brief Check if the data starts with the fixed EDID header.
+     * @param data Data to check.
+     * @returns True if the header is present, false otherwise.
+     * @note Usable in constant expressions.
+     */
+    [[nodiscard]] static constexpr bool hasFixedHeader(const std::span<const std::byte> data) {
+      constexpr std::array<std::uint8_t, 8> fixed_header {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+      if (data.size() < fixed_header.size()) {
+        return false;
+      }
+
+      for (std::size_t i {0}; i < fixed_header.size(); ++i) {
+        if (std::to_integer<std::uint8_t>(data[i]) != fixed_header[i]) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief Check if the block has a valid checksum.
+     * @param block Data of a single block.
+     * @returns True if the block is complete and its checksum is valid, false otherwise.
+     * @note Usable in constant expressions. At runtime the SIMD implementation is used.
+     */
+    [[nodiscard]] static constexpr bool isChecksumValid(const std::span<const std::byte> block) {
+      if (block.size() < BLOCK_SIZE) {
+        return false;
+      }
+
+      if (std::is_constant_evaluated()) {
+        std::uint8_t sum {0};
+        for (std::size_t i {0}; i < BLOCK_SIZE; ++i) {
+          sum = static_cast<std::uint8_t>(sum + std::to_integer<std::uint8_t>(block[i]));
+        }
+        return sum == 0;
+      }
+      return detail::getEdidBlockSumFunction()(block.data()) == 0;
+    }
+
+    /**
+     * @brief Check if the base block has the fixed header and a valid checksum.
+     * @param data Data to check.
+     * @returns True if the base block is valid, false otherwise.
+     * @note Usable in constant expressions, e.g. `static_assert(EdidView::isBaseBlockValid(FIXTURE));`.
+     */
+    [[nodiscard]] static constexpr bool isBaseBlockValid(const std::span<const std::byte> data) {
+      return data.size() >= BLOCK_SIZE && hasFixedHeader(data) && isChecksumValid(data.first(BLOCK_SIZE));
+    }
+
+    /**
+     * @brief Decode the manufacturer ID from the base block.
+     * @param data Data of the base block.
+     * @returns Three characters that should be in the A-Z range for valid data.
+     * @note Usable in constant expressions.
+     */
+    [[nodiscard]] static constexpr std::array<char, 3> decodeManufacturerId(const std::span<const std::byte> data) {
+      constexpr char ascii_offset {'@'};
+
+      const auto byte_a {std::to_integer<std::uint8_t>(data[8])};
+      const auto byte_b {std::to_integer<std::uint8_t>(data[9])};
+      return {
+        static_cast<char>(ascii_offset + ((byte_a & 0x7C) >> 2)),
+        static_cast<char>(ascii_offset + ((byte_a & 0x03) << 3) + ((byte_b & 0xE0) >> 5)),
+        static_cast<char>(ascii_offset + (byte_b & 0x1F))
+      };
+    }
+
+    /**
+     * @brief Check if the decoded manufacturer ID consists of the A-Z characters only.
+     * @param manufacturer_id Decoded manufacturer ID.
+     * @returns True if the ID is valid, false otherwise.
+     * @note Usable in constant expressions.
+     */
+    [[nodiscard]] static constexpr bool isManufacturerIdValid(const std::array<char, 3> &manufacturer_id) {
+      for (const char ch : manufacturer_id) {
+        if (ch < 'A' || ch > 'Z') {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief Decode the product code from the base block.
+     * @param data Data of the base block.
+     * @returns Product code.
+     * @note Usable in constant expressions.
+     */
+    [[nodiscard]] static constexpr std::uint16_t decodeProductCode(const std::span<const std::byte> data) {
+      return static_cast<std::uint16_t>(std::to_integer<std::uint16_t>(data[10]) | std::to_integer<std::uint16_t>(data[11]) << 8);
+    }
+
+    /**
+     * @brief Format the product code the same way it is represented in the EdidData.
+     * @param product_code Product code to format.
+     * @returns Four uppercase HEX characters.
+     * @note Usable in constant expressions.
+     */
+    [[nodiscard]] static constexpr std::array<char, 4> formatProductCode(const std::uint16_t product_code) {
+      constexpr std::array<char, 16> hex_digits {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+      return {
+        hex_digits[(product_code >> 12) & 0x0F],
+        hex_digits[(product_code >> 8) & 0x0F],
+        hex_digits[(product_code >> 4) & 0x0F],
+        hex_digits[product_code & 0x0F]
+      };
+    }
+
+    /**
+     * @brief Decode the serial number from the base block.
+     * @param data Data of the base block.
+     * @returns Serial number.
+     * @note Usable in constant expressions.
+     */
+    [[nodiscard]] static constexpr std::uint32_t decodeSerialNumber(const std::span<const std::byte> data) {
+      return std::to_integer<std::uint32_t>(data[12]) |
+             std::to_integer<std::uint32_t>(data[13]) << 8 |
+             std::to_integer<std::uint32_t>(data[14]) << 16 |
+             std::to_integer<std::uint32_t>(data[15]) << 24;
+    }
+
+    /**
+     * @brief Decode the 18-byte detailed timing descriptor.
+     * @param descriptor Descriptor data.
+     * @returns Decoded timing or empty optional if the descriptor is not a timing descriptor.
+     */
+    [[nodiscard]] static std::optional<EdidDetailedTiming> decodeDetailedTiming(std::span<const std::byte> descriptor);
+
+    /**
+     * @brief Decode the 1-byte short video descriptor.
+     * @param descriptor Descriptor data.
+     * @returns Decoded descriptor or empty optional if the value is reserved.
+     */
+    [[nodiscard]] static std::optional<EdidVideoDescriptor> decodeVideoDescriptor(std::byte descriptor);
+
+    /**
+     * @brief Decode the 3-byte short audio descriptor.
+     * @param descriptor Descriptor data.
+     * @returns Decoded descriptor.
+     */
+    [[nodiscard]] static EdidAudioDescriptor decodeAudioDescriptor(std::span<const std::byte> descriptor);
+
+  private:
+    static constexpr std::size_t BASE_DESCRIPTORS_OFFSET {54};
+    static constexpr std::size_t DESCRIPTOR_SIZE {18};
+    static constexpr std::size_t CHECKSUM_OFFSET {127};
+    static constexpr std::size_t CTA_DATA_BLOCKS_OFFSET {4};
+    static constexpr std::size_t AUDIO_DESCRIPTOR_SIZE {3};
+    static constexpr std::uint8_t CTA_AUDIO_TAG {1};
+    static constexpr std::uint8_t CTA_VIDEO_TAG {2};
+
+    friend class EdidStreamParser;
+
+    /**
+     * @brief A private constructor to ensure that only valid views are created.
+     * @param data Validated data.
+     */
+    explicit EdidView(std::span<const std::byte> data);
+
+    /**
+     * @brief Invoke the callback for every valid CTA-861 extension block.
+     * @param callback Callback with a `void(std::span<const std::byte> block)` signature.
+     */
+    template<class Callback>
+    void forEachCtaBlock(Callback &&callback) const {
+      for (std::size_t index {1}; index < getBlockCount(); ++index) {
+        const auto block {getBlock(index)};
+        if (std::to_integer<std::uint8_t>(block[0]) == CTA_EXTENSION_TAG && isBlockValid(index)) {
+          callback(block);
+        }
+      }
+    }
+
+    std::span<const std::byte> m_data; /**< Data that is limited to the available blocks. */
+  };
+}  // namespace display_device
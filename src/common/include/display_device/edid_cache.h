@@ -0,0 +1,100 @@
+/**
+ * @file src/common/include/display_device/edid_cache.h
+ * @brief Declarations for the EdidCache.
+ */
+#pragma once
+
+// system includes
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+// local includes
+#include "types.h"
+
+namespace display_device {
+  /**
+   * @brief A thread-safe, content-addressed cache for the parsed EDID data.
+   *
+   * Entries are keyed by a fast hash of the raw EDID blob and are evicted
+   * in the least-recently-used order once the capacity is reached. The raw
+   * blob is kept alongside the parsed data, so that a hash collision can never
+   * return data for a different display.
+   */
+  class EdidCache {
+  public:
+    /**
+     * @brief Cache statistics.
+     */
+    struct Stats {
+      std::uint64_t m_hits {}; /**< Number of lookups that were served from the cache. */
+      std::uint64_t m_misses {}; /**< Number of lookups that had to parse the data. */
+      std::uint64_t m_evictions {}; /**< Number of entries evicted due to the capacity limit. */
+      std::size_t m_size {}; /**< Current number of entries. */
+    };
+
+    static constexpr std::size_t DEFAULT_CAPACITY {64}; /**< Default capacity of the process-wide cache. */
+
+    /**
+     * @brief Get the process-wide cache instance.
+     * @returns Process-wide cache with the default capacity.
+     * @examples
+     * const auto edid { EdidCache::get().parse(data) };
+     * @examples_end
+     */
+    static EdidCache &get();
+
+    /**
+     * @brief Default constructor.
+     * @param capacity Maximum number of entries. Throws on 0.
+     */
+    explicit EdidCache(std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Parse the EDID data or return the previously parsed result for the same data.
+     * @param data Raw EDID data.
+     * @returns Shared (interned) parsed data or nullptr if the data could not be parsed.
+     * @note Data that fails to parse is cached too, so that it is not re-parsed (and re-logged) every time.
+     * @see EdidData::parse for more details.
+     */
+    [[nodiscard]] std::shared_ptr<const EdidData> parse(std::span<const std::byte> data);
+
+    /**
+     * @brief Remove all entries from the cache.
+     * @note Statistics are not reset.
+     */
+    void clear();
+
+    /**
+     * @brief Get the current cache statistics.
+     * @returns Cache statistics.
+     */
+    [[nodiscard]] Stats getStats() const;
+
+  private:
+    /**
+     * @brief A single cache entry.
+     */
+    struct Entry {
+      std::uint64_t m_hash; /**< Hash of the raw data. */
+      std::vector<std::byte> m_data; /**< Raw data for collision verification. */
+      std::shared_ptr<const EdidData> m_edid; /**< Parsed data or nullptr. */
+    };
+
+    using EntryList = std::list<Entry>;
+
+    std::size_t m_capacity; /**< Maximum number of entries. */
+    EntryList m_entries; /**< Entries in the most-recently-used order. */
+    std::unordered_map<std::uint64_t, EntryList::iterator> m_index; /**< Hash to entry mapping. */
+    mutable std::mutex m_mutex; /**< A mutex for synchronizing the access to entries. */
+
+    std::atomic<std::uint64_t> m_hits {0}; /**< Hit counter. */
+    std::atomic<std::uint64_t> m_misses {0}; /**< Miss counter. */
+    std::atomic<std::uint64_t> m_evictions {0}; /**< Eviction counter. */
+  };
+}  // namespace display_device
@@ -0,0 +1,90 @@
+/**
+ * @file src/common/include/display_device/edid_mode_table.h
+ * @brief Declarations for the EDID derived display mode table.
+ */
+#pragma once
+
+// system includes
+#include <optional>
+#include <vector>
+
+// local includes
+#include "edid.h"
+#include "types.h"
+
+namespace display_device {
+  /**
+   * @brief A display mode advertised by the EDID.
+   */
+  struct EdidMode {
+    Resolution m_resolution {}; /**< Resolution of the mode. */
+    Rational m_refresh_rate {}; /**< Refresh rate of the mode. */
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend bool operator==(const EdidMode &lhs, const EdidMode &rhs);
+  };
+
+  /**
+   * @brief A sorted table of the progressive display modes advertised by the EDID.
+   *
+   * Modes are collected from the established timings, standard timings and
+   * detailed timing descriptors (base block and CTA-861 extensions). The table
+   * is built once, after which the closest mode can be looked up in a logarithmic time.
+   */
+  class EdidModeTable {
+  public:
+    /**
+     * @brief Build the table from the EDID.
+     * @param view View of the EDID data.
+     * @returns Mode table, which can be empty if the EDID does not advertise any modes.
+     * @examples
+     * if (const auto view {EdidView::create(data)}; view) {
+     *   const auto table {EdidModeTable::create(*view)};
+     * }
+     * @examples_end
+     */
+    [[nodiscard]] static EdidModeTable create(const EdidView &view);
+
+    /**
+     * @brief Get all modes.
+     * @returns Unique modes sorted by resolution and then by the refresh rate.
+     */
+    [[nodiscard]] const std::vector<EdidMode> &getModes() const;
+
+    /**
+     * @brief Find the closest mode.
+     * @param resolution Requested resolution. The resolution with the closest pixel count
+     *                   (and then with the closest width) is picked if there is no exact match.
+     * @param refresh_rate Requested refresh rate. The highest one is picked if not specified.
+     * @returns Closest mode or empty optional if the table is empty.
+     * @examples
+     * const auto mode {table.findClosestMode({1920, 1080}, Rational {60, 1})};
+     * @examples_end
+     */
+    [[nodiscard]] std::optional<EdidMode> findClosestMode(const Resolution &resolution, const std::optional<FloatingPoint> &refresh_rate) const;
+
+    /**
+     * @brief Find the closest mode for the configuration.
+     * @param config Configuration to find the mode for.
+     * @param current_resolution Resolution to use if the configuration does not specify one.
+     * @returns Closest mode or empty optional if the table is empty.
+     * @see findClosestMode for more details.
+     */
+    [[nodiscard]] std::optional<EdidMode> findClosestMode(const SingleDisplayConfiguration &config, const Resolution &current_resolution) const;
+
+  private:
+    /**
+     * @brief A range of modes sharing the same resolution.
+     */
+    struct ResolutionRange {
+      Resolution m_resolution {}; /**< Shared resolution. */
+      std::size_t m_begin {}; /**< Index of the first mode. */
+      std::size_t m_end {}; /**< Index past the last mode. */
+    };
+
+    std::vector<EdidMode> m_modes; /**< Modes sorted by resolution and refresh rate. */
+    std::vector<ResolutionRange> m_ranges; /**< Resolution ranges sorted by pixel count and width. */
+  };
+}  // namespace display_device
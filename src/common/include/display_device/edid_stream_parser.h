@@ -0,0 +1,109 @@
+/**
+ * @file src/common/include/display_device/edid_stream_parser.h
+ * @brief Declarations for the incremental EDID parser.
+ */
+#pragma once
+
+// system includes
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+// local includes
+#include "edid.h"
+#include "types.h"
+
+namespace display_device {
+  /**
+   * @brief A resumable EDID parser that is fed the data as it arrives (e.g. block-at-a-time DDC reads).
+   *
+   * The base block is validated and decoded as soon as it is complete. Depending
+   * on the scope, the parser either finishes right there or waits for all of the
+   * extension blocks declared by the base block.
+   */
+  class EdidStreamParser {
+  public:
+    /**
+     * @brief Parsing status.
+     */
+    enum class Status {
+      NeedMoreData,  ///< More data needs to be fed
+      Complete,  ///< All of the requested blocks have been received
+      Failed  ///< The data is invalid, feeding more will not help
+    };
+
+    /**
+     * @brief Blocks that are required for parsing to complete.
+     */
+    enum class Scope {
+      BaseBlock,  ///< Only the base block (enough for EdidData)
+      AllBlocks  ///< Base block and all of the declared extension blocks
+    };
+
+    /**
+     * @brief Default constructor.
+     * @param scope Blocks that are required for parsing to complete.
+     */
+    explicit EdidStreamParser(Scope scope = Scope::AllBlocks);
+
+    /**
+     * @brief Feed the next chunk of the EDID data.
+     * @param data Next chunk of data. It does not need to be block aligned.
+     * @returns Parsing status after processing the data. Data fed after
+     *          the parsing has finished is ignored.
+     * @examples
+     * EdidStreamParser parser {EdidStreamParser::Scope::BaseBlock};
+     * while (parser.getStatus() == EdidStreamParser::Status::NeedMoreData) {
+     *   if (parser.feed(readDdcBlock()) == EdidStreamParser::Status::Complete) {
+     *     const auto edid {parser.getEdidData()};
+     *   }
+     * }
+     * @examples_end
+     */
+    Status feed(std::span<const std::byte> data);
+
+    /**
+     * @brief Get the current parsing status.
+     * @returns Parsing status.
+     */
+    [[nodiscard]] Status getStatus() const;
+
+    /**
+     * @brief Get the number of blocks that still need to be fed.
+     * @returns Number of blocks (a partially received block counts as one), 0 if parsing has finished.
+     */
+    [[nodiscard]] std::size_t getBlocksNeeded() const;
+
+    /**
+     * @brief Get the data decoded from the base block.
+     * @returns Decoded data or empty optional if the base block was not received or is invalid.
+     */
+    [[nodiscard]] std::optional<EdidData> getEdidData() const;
+
+    /**
+     * @brief Get the view for the blocks that have been received completely.
+     * @returns View for the data or empty optional if the base block was not received or is invalid.
+     * @warning The view is invalidated by the next `feed` or `reset` call.
+     */
+    [[nodiscard]] std::optional<EdidView> getView() const;
+
+    /**
+     * @brief Reset the parser to the initial state, keeping the scope.
+     */
+    void reset();
+
+  private:
+    /**
+     * @brief Validate and decode the base block once it is received.
+     * @returns True if the block is valid, false otherwise.
+     */
+    bool processBaseBlock();
+
+    Scope m_scope; /**< Blocks that are required for parsing to complete. */
+    Status m_status {Status::NeedMoreData}; /**< Current parsing status. */
+    std::vector<std::byte> m_data; /**< Received data. */
+    std::size_t m_expected_blocks {1}; /**< Number of blocks needed to complete (known after the base block). */
+    std::optional<EdidData> m_edid_data; /**< Data decoded from the base block. */
+  };
+}  // namespace display_device
@@ -0,0 +1,47 @@
+/**
+ * @file src/common/include/display_device/edid_validation.h
+ * @brief Declarations for the batched EDID validation.
+ */
+#pragma once
+
+// system includes
+#include <cstddef>
+#include <span>
+
+namespace display_device {
+  /**
+   * @brief Result of the EDID validation.
+   */
+  enum class EdidValidationResult {
+    Valid,  ///< Header and all of the available blocks are valid
+    InvalidSize,  ///< Data is empty or smaller than a single block
+    InvalidHeader,  ///< Fixed header is missing
+    InvalidChecksum  ///< At least one of the available blocks has an invalid checksum
+  };
+
+  /**
+   * @brief Validate the fixed header and checksums of the EDID blocks.
+   * @param data Data to validate.
+   * @returns Validation result.
+   * @note Only the blocks that are available in the data are validated (extension count is
+   *       capped by the data size), the same way as EdidView treats the data.
+   * @examples
+   * const std::vector<std::byte> data { ... };
+   * const bool is_valid { validateEdid(data) == EdidValidationResult::Valid };
+   * @examples_end
+   */
+  [[nodiscard]] EdidValidationResult validateEdid(std::span<const std::byte> data);
+
+  /**
+   * @brief Validate the fixed header and checksums for a batch of EDIDs.
+   * @param edids EDIDs to validate.
+   * @param results Output for the results with the same size as `edids`. Throws on size mismatch.
+   * @note Block checksums are computed using the best SIMD implementation available at runtime.
+   * @examples
+   * const std::vector<std::span<const std::byte>> edids { ... };
+   * std::vector<EdidValidationResult> results(edids.size());
+   * validateEdids(edids, results);
+   * @examples_end
+   */
+  void validateEdids(std::span<const std::span<const std::byte>> edids, std::span<EdidValidationResult> results);
+}  // namespace display_device
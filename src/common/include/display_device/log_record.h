@@ -0,0 +1,141 @@
+/**
+ * @file src/common/include/display_device/log_record.h
+ * @brief Declarations for the structured log record.
+ */
+#pragma once
+
+// system includes
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace display_device {
+  /**
+   * @brief A named value for the structured log record.
+   * @see logField for creating the fields.
+   */
+  template<class T>
+  struct LogField {
+    std::string_view m_name; /**< Name of the field. */
+    const T &m_value; /**< Value of the field. */
+  };
+
+  /**
+   * @brief Create a named field for the structured log record.
+   * @param name Name of the field (should be a short identifier).
+   * @param value Value of the field.
+   * @returns Field that can be streamed into the DD_LOG_RECORD.
+   * @examples
+   * DD_LOG_RECORD(info) << "Applying mode " << logField("width", 1920) << " " << logField("height", 1080);
+   * @examples_end
+   */
+  template<class T>
+  LogField<T> logField(const std::string_view name, const T &value) {
+    return {name, value};
+  }
+
+  /**
+   * @brief A log record that stores the typed values in a compact binary form
+   *        and only turns them into text on demand.
+   */
+  class LogRecord {
+  public:
+    /**
+     * @brief Decoded value of the field.
+     */
+    using Value = std::variant<bool, std::int64_t, std::uint64_t, double, std::string_view>;
+
+    /**
+     * @brief Decoded field of the record.
+     */
+    struct Field {
+      std::string_view m_name; /**< Name of the field (empty for unnamed values). */
+      Value m_value; /**< Value of the field. */
+    };
+
+    /**
+     * @brief Append the value to the record.
+     * @param name Name of the field (empty for unnamed values).
+     * @param value Value to append. Types other than booleans, characters, numbers and strings
+     *              are converted to the string via the `operator<<` right away.
+     * @examples
+     * LogRecord record;
+     * record.append("width", 1920);
+     * @examples_end
+     */
+    template<class T>
+    void append(const std::string_view name, const T &value) {
+      using Type = std::remove_cvref_t<T>;
+      if constexpr (std::is_same_v<Type, bool>) {
+        appendBool(name, value);
+      } else if constexpr (std::is_same_v<Type, char> || std::is_same_v<Type, signed char> || std::is_same_v<Type, unsigned char>) {
+        const auto character {static_cast<char>(value)};
+        appendString(name, std::string_view {&character, 1});
+      } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+        appendInt(name, value);
+      } else if constexpr (std::is_integral_v<Type>) {
+        appendUInt(name, value);
+      } else if constexpr (std::is_floating_point_v<Type>) {
+        appendDouble(name, static_cast<double>(value));
+      } else if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+        appendString(name, value);
+      } else {
+        std::ostringstream stream;
+        stream << value;
+        appendString(name, stream.view());
+      }
+    }
+
+    /**
+     * @brief Decode the fields of the record.
+     * @returns Fields in the order they were appended. The string views point into this record.
+     */
+    [[nodiscard]] std::vector<Field> getFields() const;
+
+    /**
+     * @brief Format the record as text, the same way as DD_LOG would (named fields are written as "name=value").
+     * @returns Formatted record.
+     */
+    [[nodiscard]] std::string format() const;
+
+    /**
+     * @brief Check if the record has no fields.
+     * @returns True if empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Get the encoded fields, e.g. for copying the record into a preallocated buffer.
+     * @returns Encoded fields that can be turned back into the record via `fromEncoded`.
+     */
+    [[nodiscard]] std::span<const std::byte> getEncoded() const;
+
+    /**
+     * @brief Create the record from the encoded fields.
+     * @param data Encoded fields previously returned by `getEncoded`.
+     * @returns Record with the same fields.
+     */
+    [[nodiscard]] static LogRecord fromEncoded(std::span<const std::byte> data);
+
+    /**
+     * @brief Comparator for strict equality (same fields with the same values).
+     */
+    friend bool operator==(const LogRecord &lhs, const LogRecord &rhs);
+
+  private:
+    void appendBool(std::string_view name, bool value);
+    void appendInt(std::string_view name, std::int64_t value);
+    void appendUInt(std::string_view name, std::uint64_t value);
+    void appendDouble(std::string_view name, double value);
+    void appendString(std::string_view name, std::string_view value);
+    void appendHeader(std::uint8_t tag, std::string_view name);
+
+    std::vector<std::byte> m_data; /**< Encoded fields: tag, name length, name, payload. */
+  };
+}  // namespace display_device
@@ -5,9 +5,36 @@
 #pragma once
 
 // system includes
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <chrono>
+#include <cstdint>
 #include <functional>
-#include <sstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
 #include <string>
+#include <string_view>
+#include <variant>
+
+// local includes
+#include "detail/log_buffer.h"
+#include "detail/rcu_ptr.h"
+#include "log_record.h"
+
+/**
+ * @brief Numeric value of the lowest `Logger::LogLevel` that is compiled in.
+ *
+ * DD_LOG statements below this level are discarded at compile time, regardless
+ * of the runtime log level. Normally set via the DD_LOG_COMPILE_LEVEL CMake option.
+ */
+#ifndef DD_LOG_COMPILE_LEVEL
+  #define DD_LOG_COMPILE_LEVEL 0
+#endif
 
 namespace display_device {
   /**
@@ -34,11 +61,56 @@ namespace display_device {
       fatal  ///< Fatal level
     };
 
+    /**
+     * @brief Defines the categories that can have their own log level.
+     * @note All categories are in lower-case on purpose to fit the log level style.
+     */
+    enum class LogCategory {
+      general = 0,  ///< Everything that does not belong to a more specific category
+      edid,  ///< EDID and DisplayID parsing
+      scheduler,  ///< RetryScheduler
+      json,  ///< JSON (de)serialization
+      persistence,  ///< Settings persistence
+      platform  ///< Platform specific display device layer
+    };
+
+    /**
+     * @brief Number of the values in the LogCategory enum.
+     */
+    static constexpr std::size_t LOG_CATEGORY_COUNT {static_cast<std::size_t>(LogCategory::platform) + 1};
+
     /**
      * @brief Defines the callback type for log data re-routing.
      */
     using Callback = std::function<void(LogLevel, std::string)>;
 
+    /**
+     * @brief Defines the callback type for structured log data re-routing.
+     */
+    using RecordCallback = std::function<void(LogLevel, const LogRecord &)>;
+
+    /**
+     * @brief Identifier of the additional sink.
+     */
+    using SinkId = std::uint64_t;
+
+    /**
+     * @brief Defines what happens to the record when the asynchronous queue is full.
+     */
+    enum class OverflowPolicy {
+      Drop,  ///< Silently discard the new record.
+      Block,  ///< Wait until the background thread frees up some space.
+      Count  ///< Discard the new record and report the amount of discarded records once there is space again.
+    };
+
+    /**
+     * @brief Configuration for the asynchronous mode.
+     */
+    struct AsyncOptions {
+      std::size_t m_capacity {1024}; /**< Maximum number of queued records (rounded up to a power of 2). */
+      OverflowPolicy m_overflow_policy {OverflowPolicy::Count}; /**< What to do when the queue is full. */
+    };
+
     /**
      * @brief Get the singleton instance.
      * @returns Singleton instance for the class.
@@ -49,7 +121,7 @@ namespace display_device {
     static Logger &get();
 
     /**
-     * @brief Set the log level for the logger.
+     * @brief Set the log level for the logger (all categories).
      * @param log_level New level to be used.
      * @examples
      * Logger::get().setLogLevel(Logger::LogLevel::Info);
@@ -57,6 +129,24 @@ namespace display_device {
      */
     void setLogLevel(LogLevel log_level);
 
+    /**
+     * @brief Set the log level for a single category.
+     * @param category Category to change the level for.
+     * @param log_level New level to be used.
+     * @examples
+     * Logger::get().setLogLevel(Logger::LogLevel::Info);
+     * Logger::get().setLogLevel(Logger::LogCategory::edid, Logger::LogLevel::verbose);
+     * @examples_end
+     */
+    void setLogLevel(LogCategory category, LogLevel log_level);
+
+    /**
+     * @brief Get the log level of the category.
+     * @param category Category to get the level for.
+     * @returns The currently enabled log level.
+     */
+    [[nodiscard]] LogLevel getLogLevel(LogCategory category) const;
+
     /**
      * @brief Check if log level is currently enabled.
      * @param log_level Log level to check.
@@ -65,7 +155,34 @@ namespace display_device {
      * const bool is_enabled { Logger::get().isLogLevelEnabled(Logger::LogLevel::Info) };
      * @examples_end
      */
-    [[nodiscard]] bool isLogLevelEnabled(LogLevel log_level) const;
+    [[nodiscard]] bool isLogLevelEnabled(LogLevel log_level) const {
+      return isLogLevelEnabled(LogCategory::general, log_level);
+    }
+
+    /**
+     * @brief Check if log level is currently enabled for the category.
+     * @param category Category to check.
+     * @param log_level Log level to check.
+     * @returns True if log level is enabled.
+     * @note Only a single relaxed atomic load, so it's cheap enough to be called for every statement.
+     * @examples
+     * const bool is_enabled { Logger::get().isLogLevelEnabled(Logger::LogCategory::edid, Logger::LogLevel::Info) };
+     * @examples_end
+     */
+    [[nodiscard]] bool isLogLevelEnabled(const LogCategory category, const LogLevel log_level) const {
+      return log_level >= m_log_levels[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Check if log level is currently enabled for the category or captured by the flight recorder.
+     * @param category Category to check.
+     * @param log_level Log level to check.
+     * @returns True if the statement needs to be evaluated.
+     * @note Only a single relaxed atomic load of the precomputed threshold, same as `isLogLevelEnabled`.
+     */
+    [[nodiscard]] bool isLogLevelCaptured(const LogCategory category, const LogLevel log_level) const {
+      return log_level >= m_captured_levels[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+    }
 
     /**
      * @brief Set custom callback for writing the logs.
@@ -78,6 +195,193 @@ namespace display_device {
      */
     void setCustomCallback(Callback callback);
 
+    /**
+     * @brief Set custom callback for the structured log records.
+     *
+     * Invoked in addition to the custom callback, but replaces the standard output if the
+     * custom callback is not set. The plain text logs are passed to it as records with a
+     * single unnamed string field.
+     *
+     * @param callback New callback to be used or nullptr to reset to the default.
+     * @examples
+     * Logger::get().setRecordCallback([](const LogLevel level, const LogRecord &record){
+     *    for (const auto &field : record.getFields()) {
+     *      // forward the fields to the collector or something
+     *    }
+     * });
+     * @examples_end
+     */
+    void setRecordCallback(RecordCallback callback);
+
+    /**
+     * @brief Add a sink that receives the logs in addition to the custom callback (or the standard output).
+     *
+     * Each sink has its own log level that is checked on top of the logger's log level,
+     * so a sink can only receive the logs that pass the logger's log level too.
+     *
+     * @param log_level Lowest log level to be passed to the sink.
+     * @param callback Callback to pass the log data to.
+     * @returns Identifier for modifying or removing the sink later.
+     * @note The sinks (and the callbacks above) can be changed while other threads are logging.
+     *       The writers keep using the previous configuration until their current write is done,
+     *       and the change only returns after that, so the replaced callbacks are no longer invoked.
+     *       The sinks and the callbacks can also be changed from within the callbacks or sinks (e.g. to
+     *       remove a one-shot sink). The change then returns right away and the writes in progress
+     *       finish with the previous configuration.
+     * @examples
+     * const auto id {Logger::get().addSink(Logger::LogLevel::warning, [](const LogLevel level, std::string value){
+     *    // write to file or something
+     * })};
+     * @examples_end
+     */
+    SinkId addSink(LogLevel log_level, Callback callback);
+
+    /**
+     * @brief Change the log level of the sink.
+     * @param id Identifier of the sink.
+     * @param log_level New lowest log level to be passed to the sink.
+     * @returns True if the sink was found, false otherwise.
+     */
+    bool setSinkLogLevel(SinkId id, LogLevel log_level);
+
+    /**
+     * @brief Remove the sink.
+     * @param id Identifier of the sink.
+     * @returns True if the sink was found, false otherwise.
+     */
+    bool removeSink(SinkId id);
+
+    /**
+     * @brief Remove all of the sinks added via `addSink`.
+     */
+    void removeAllSinks();
+
+    /**
+     * @brief Enable the asynchronous mode.
+     *
+     * The records are pushed to a bounded lock-free queue and a background thread
+     * writes them out, so that the logging thread is not stalled by the output.
+     * The custom callback (if any) will be invoked from the background thread.
+     *
+     * @param options Configuration for the asynchronous mode.
+     * @note If the asynchronous mode is already enabled, it is restarted with the new options.
+     * @note Can be called while other threads are logging. The records written while switching
+     *       may be written out synchronously.
+     * @throws std::logic_error If called from within the callbacks or sinks.
+     * @examples
+     * Logger::get().enableAsync({.m_capacity = 4096, .m_overflow_policy = Logger::OverflowPolicy::Block});
+     * @examples_end
+     */
+    void enableAsync(const AsyncOptions &options);
+
+    /**
+     * @brief Write out all of the queued records and go back to the synchronous mode.
+     * @note Waits until the other threads are done pushing to the queue.
+     * @throws std::logic_error If called from within the callbacks or sinks.
+     * @examples
+     * Logger::get().disableAsync();
+     * @examples_end
+     */
+    void disableAsync();
+
+    /**
+     * @brief Check if the asynchronous mode is enabled.
+     * @returns True if enabled, false otherwise.
+     */
+    [[nodiscard]] bool isAsyncEnabled() const;
+
+    /**
+     * @brief Block until all of the records written before this call are written out.
+     * @note Does nothing in the synchronous mode.
+     * @examples
+     * DD_LOG(fatal) << "Bye!";
+     * Logger::get().flush();
+     * @examples_end
+     */
+    void flush();
+
+    /**
+     * @brief Get the number of records that were discarded due to the full queue.
+     * @returns Number of discarded records since the asynchronous mode was enabled or 0 in the synchronous mode.
+     */
+    [[nodiscard]] std::uint64_t getDroppedRecordCount() const;
+
+    /**
+     * @brief Enable or disable the deduplication of identical consecutive messages.
+     *
+     * When enabled, the repeated messages (same level and text) are not written out.
+     * Instead, a "Last message repeated N time(s)." summary is written once a different
+     * message arrives, `flush` is called or the deduplication is disabled.
+     *
+     * @param enabled True to enable, false to disable.
+     * @note Can be called while other threads are logging.
+     * @throws std::logic_error If called from within the callbacks or sinks.
+     * @examples
+     * Logger::get().setDeduplicationEnabled(true);
+     * @examples_end
+     */
+    void setDeduplicationEnabled(bool enabled);
+
+    /**
+     * @brief Check if the deduplication is enabled.
+     * @returns True if enabled, false otherwise.
+     */
+    [[nodiscard]] bool isDeduplicationEnabled() const;
+
+    /**
+     * @brief Enable the flight recorder that keeps the last records of every thread in memory.
+     *
+     * The flight recorder is opt-in. While enabled, the records are captured regardless of the
+     * configured log level (but not the ones below the DD_LOG_COMPILE_LEVEL).
+     *
+     * The `DD_LOG_RECORD` statements are kept as the encoded `LogRecord` and are only formatted once
+     * `dumpFlightRecorder` is called. The text of other statements is copied as it is. Each thread
+     * has `FLIGHT_RECORDER_BYTES_PER_RECORD` bytes per record reserved, so long records (e.g. the
+     * display configuration dumps) evict more of the older ones. Only a text that does not fit
+     * the whole reserved space is cut, which is marked in the dump.
+     *
+     * Capturing costs a memcpy into the ring of the current thread and takes no locks. However,
+     * statements whose level is captured, but not enabled, are evaluated and streamed into the text,
+     * so capturing the levels below the configured log level is about 20 times slower than skipping
+     * them (~110 ns vs ~5 ns per `DD_LOG(verbose)` statement in `bench_libdisplaydevice_logging`).
+     * It is also the reason why the flight recorder is not enabled by default: the disabled
+     * statements must not be evaluated.
+     *
+     * @param records_per_thread Number of records to keep per thread (the oldest ones are overwritten).
+     * @param log_level Lowest log level to be captured.
+     * @note The previously captured records are discarded.
+     * @note DD_LOG_EVERY_N and DD_LOG_EVERY_MS statements are only captured if the log level is enabled.
+     * @examples
+     * Logger::get().enableFlightRecorder(512);
+     * @examples_end
+     */
+    void enableFlightRecorder(std::size_t records_per_thread = 256, LogLevel log_level = LogLevel::verbose);
+
+    /**
+     * @brief Stop capturing the records. The already captured records can still be dumped.
+     */
+    void disableFlightRecorder();
+
+    /**
+     * @brief Check if the flight recorder is enabled.
+     * @returns True if enabled, false otherwise.
+     */
+    [[nodiscard]] bool isFlightRecorderEnabled() const;
+
+    /**
+     * @brief Format the records captured by the flight recorder.
+     * @returns Lines of all threads ordered by time, in the same format as the standard output
+     *          plus the thread id (e.g. "[2024-01-01 00:00:00.000] VERBOSE: [1234] Hello World!").
+     * @examples
+     * if (result != SettingsManagerInterface::ApplyResult::Ok) {
+     *   DD_LOG(error) << "Failed to apply the settings! Recent logs:\n" << Logger::get().dumpFlightRecorder();
+     * }
+     * @examples_end
+     */
+    [[nodiscard]] std::string dumpFlightRecorder() const;
+
+    static constexpr std::size_t FLIGHT_RECORDER_BYTES_PER_RECORD {256}; /**< Space reserved per flight recorder record (on average, a single record can use all of it). */
+
     /**
      * @brief Write the string to the output (via callback) if the log level is enabled.
      * @param log_level Log level to be checked and (probably) written.
@@ -88,6 +392,40 @@ namespace display_device {
      */
     void write(LogLevel log_level, std::string value);
 
+    /**
+     * @brief Write the string to the output (via callback) if the log level is enabled for the category.
+     * @param category Category to be checked.
+     * @param log_level Log level to be checked and (probably) written.
+     * @param value A copy of the string to be written.
+     * @examples
+     * Logger::get().write(Logger::LogCategory::edid, Logger::LogLevel::Info, "Hello World!");
+     * @examples_end
+     */
+    void write(LogCategory category, LogLevel log_level, std::string value);
+
+    /**
+     * @brief Write the structured record to the output if the log level is enabled.
+     *
+     * The record is only formatted as text if something other than the record callback consumes it.
+     *
+     * @param log_level Log level to be checked and (probably) written.
+     * @param record Record to be written.
+     * @examples
+     * LogRecord record;
+     * record.append("width", 1920);
+     * Logger::get().write(Logger::LogLevel::Info, std::move(record));
+     * @examples_end
+     */
+    void write(LogLevel log_level, LogRecord record);
+
+    /**
+     * @brief Write the structured record to the output if the log level is enabled for the category.
+     * @param category Category to be checked.
+     * @param log_level Log level to be checked and (probably) written.
+     * @param record Record to be written.
+     */
+    void write(LogCategory category, LogLevel log_level, LogRecord record);
+
     /**
      * @brief A deleted copy constructor for singleton pattern.
      * @note Public to ensure better compiler error message.
@@ -100,16 +438,102 @@ namespace display_device {
      */
     void operator=(Logger const &) = delete;
 
+    /**
+     * @brief Write out all of the queued records before shutting down.
+     */
+    ~Logger();
+
   private:
+    class AsyncBackend;
+    class Deduplicator;
+    class FlightRecorder;
+    struct Config;
+
+    /**
+     * @brief Capture the text into the flight recorder if it is enabled for the log level.
+     * @param log_level Log level of the text.
+     * @param value Text to be captured.
+     */
+    void captureFlightRecord(LogLevel log_level, std::string_view value);
+
+    /**
+     * @brief Capture the record (without formatting it) into the flight recorder if it is enabled for the log level.
+     * @param log_level Log level of the record.
+     * @param record Record to be captured.
+     */
+    void captureFlightRecord(LogLevel log_level, const LogRecord &record);
+
+    /**
+     * @brief Pass the already filtered text or record to the deduplication (if enabled) and then dispatch it.
+     * @param config Configuration loaded by the writer.
+     * @param log_level Log level of the payload.
+     * @param payload Text or the record to be written.
+     */
+    void output(const Config &config, LogLevel log_level, std::variant<std::string, LogRecord> payload);
+
+    /**
+     * @brief Pass the already filtered text or record to the asynchronous backend or to the output.
+     * @param config Configuration loaded by the writer.
+     * @param log_level Log level of the payload.
+     * @param payload Text or the record to be written.
+     */
+    void dispatch(const Config &config, LogLevel log_level, std::variant<std::string, LogRecord> payload);
+
+    /**
+     * @brief Write the text that is not owned yet, avoiding the copy if it can be written out directly.
+     * @param category Category to be checked.
+     * @param log_level Log level to be checked and (probably) written.
+     * @param value Text to be written.
+     */
+    void writeText(LogCategory category, LogLevel log_level, std::string_view value);
+
+    /**
+     * @brief Copy the current configuration, modify the copy and publish it for the writers.
+     * @param update Function to modify the copy.
+     * @returns The previous configuration, which is no longer used by any writer, or nullptr if
+     *          it's still used by the current thread (called from within the callbacks or sinks).
+     */
+    std::unique_ptr<const Config> updateConfig(const std::function<void(Config &)> &update);
+
+    /**
+     * @brief Throw if the current thread is using the configuration, i.e. it's within the callbacks or sinks.
+     * @param function_name Name of the function for the error message.
+     * @throws std::logic_error If called from within the callbacks or sinks.
+     */
+    static void throwIfReadingConfig(std::string_view function_name);
+
+    /**
+     * @brief Recompute the lowest level that is either enabled or captured by the flight recorder for every category.
+     * @note Must be called with the m_levels_mutex held.
+     */
+    void updateCapturedLevelsUnlocked();
+
+    friend class LogWriter;
+
     /**
      * @brief A private constructor to ensure the singleton pattern.
      */
     explicit Logger();
 
-    LogLevel m_enabled_log_level; /**< The currently enabled log level. */
-    Callback m_custom_callback; /**< Custom callback to pass log data to. */
+    std::mutex m_levels_mutex; /**< Serializes the changes of the log levels, so the captured levels stay consistent (writers do not use it). */
+    std::array<std::atomic<LogLevel>, LOG_CATEGORY_COUNT> m_log_levels; /**< The currently enabled log level per category. */
+    std::array<std::atomic<LogLevel>, LOG_CATEGORY_COUNT> m_captured_levels; /**< Lower one of the enabled and the flight recorder log level per category. */
+    std::mutex m_config_mutex; /**< Serializes the switching of the asynchronous mode and the deduplication (writers do not use it). */
+    detail::RcuPtr<Config> m_config; /**< Immutable snapshot of the callbacks, sinks, asynchronous backend and deduplication, loaded once per write. */
+    SinkId m_next_sink_id {0}; /**< Identifier for the next added sink (only changed by the configuration updates). */
+    std::unique_ptr<FlightRecorder> m_flight_recorder; /**< Per-thread rings of the last records (always allocated). */
+    std::atomic<int> m_flight_recorder_level {std::numeric_limits<int>::max()}; /**< Lowest captured log level (or max if disabled). */
   };
 
+  namespace detail {
+    /**
+     * @brief Get the padded log level prefix that is written before the message (e.g. "INFO:    ").
+     * @param log_level Log level to get the prefix for.
+     * @returns Prefix for the log level.
+     */
+    std::string_view getLogLevelPrefix(Logger::LogLevel log_level);
+  }  // namespace detail
+
   /**
    * @brief A helper class for accumulating output via the stream operator and then writing it out at once.
    */
@@ -118,8 +542,9 @@ namespace display_device {
     /**
      * @brief Constructor scoped writer utility.
      * @param log_level Level to be used when writing out the output.
+     * @param category Category to be used when writing out the output.
      */
-    explicit LogWriter(Logger::LogLevel log_level);
+    explicit LogWriter(Logger::LogLevel log_level, Logger::LogCategory category = Logger::LogCategory::general);
 
     /**
      * @brief Write out the accumulated output.
@@ -133,23 +558,242 @@ namespace display_device {
      */
     template<class T>
     LogWriter &operator<<(T &&value) {
-      m_buffer << std::forward<T>(value);
+      using Type = std::remove_cvref_t<T>;
+      if (m_fallback_stream) {
+        // Manipulators might have changed the formatting, so the stream is used for everything from now on
+        m_fallback_stream->m_stream << std::forward<T>(value);
+      } else if constexpr (std::is_same_v<Type, bool>) {
+        m_buffer.append(value ? "1" : "0");
+      } else if constexpr (std::is_same_v<Type, char> || std::is_same_v<Type, signed char> || std::is_same_v<Type, unsigned char>) {
+        const auto character {static_cast<char>(value)};
+        m_buffer.append({&character, 1});
+      } else if constexpr (std::is_arithmetic_v<Type>) {
+        m_buffer.appendNumber(value);
+      } else if constexpr (std::is_pointer_v<std::decay_t<T>> && std::is_convertible_v<T, const char *>) {
+        if (const char *text {value}; text != nullptr) {
+          m_buffer.append(text);
+        }
+      } else if constexpr (std::is_convertible_v<T, std::string_view>) {
+        m_buffer.append(std::string_view {value});
+      } else {
+        m_fallback_stream.emplace(m_buffer);
+        m_fallback_stream->m_stream << std::forward<T>(value);
+      }
       return *this;
     }
 
   private:
+    /**
+     * @brief A std::ostream that writes into the buffer, for the types that are not supported natively.
+     */
+    struct FallbackStream {
+      explicit FallbackStream(detail::LogBuffer &buffer):
+          m_stream_buffer {buffer},
+          m_stream {&m_stream_buffer} {}
+
+      detail::LogStreamBuffer m_stream_buffer;
+      std::ostream m_stream;
+    };
+
     Logger::LogLevel m_log_level; /**< Log level to be used. */
-    std::ostringstream m_buffer; /**< Buffer to hold all the output. */
+    Logger::LogCategory m_category; /**< Category to be used. */
+    detail::LogBuffer m_buffer; /**< Buffer to hold all the output. */
+    std::optional<FallbackStream> m_fallback_stream; /**< Only constructed when needed. */
   };
+
+  /**
+   * @brief A helper class for accumulating typed values via the stream operator and then writing out the record.
+   */
+  class LogRecordWriter {
+  public:
+    /**
+     * @brief Constructor scoped writer utility.
+     * @param log_level Level to be used when writing out the record.
+     * @param category Category to be used when writing out the record.
+     */
+    explicit LogRecordWriter(Logger::LogLevel log_level, Logger::LogCategory category = Logger::LogCategory::general);
+
+    /**
+     * @brief Write out the accumulated record.
+     */
+    virtual ~LogRecordWriter();
+
+    /**
+     * @brief Append the unnamed value to the record.
+     * @param value Value to be appended, see `LogRecord::append` for the supported types.
+     * @returns Reference to the writer utility for chaining the operators.
+     */
+    template<class T>
+    LogRecordWriter &operator<<(const T &value) {
+      m_record.append({}, value);
+      return *this;
+    }
+
+    /**
+     * @brief Append the named value to the record.
+     * @param field Field to be appended.
+     * @returns Reference to the writer utility for chaining the operators.
+     */
+    template<class T>
+    LogRecordWriter &operator<<(const LogField<T> &field) {
+      m_record.append(field.m_name, field.m_value);
+      return *this;
+    }
+
+  private:
+    Logger::LogLevel m_log_level; /**< Log level to be used. */
+    Logger::LogCategory m_category; /**< Category to be used. */
+    LogRecord m_record; /**< Record to hold all the output. */
+  };
+
+  namespace detail {
+    /**
+     * @brief Lock-free per call site state for the DD_LOG_EVERY_N.
+     */
+    class LogEveryNState {
+    public:
+      /**
+       * @brief Count the execution and check if it should be logged.
+       * @param n Log every n-th execution (0 is treated as 1).
+       * @returns True for the 1st, (n+1)-th, (2n+1)-th... execution.
+       */
+      bool shouldLog(const std::uint32_t n) {
+        return m_counter.fetch_add(1, std::memory_order_relaxed) % std::max<std::uint32_t>(n, 1) == 0;
+      }
+
+    private:
+      std::atomic<std::uint32_t> m_counter {0}; /**< Number of executions so far. */
+    };
+
+    /**
+     * @brief Lock-free per call site state for the DD_LOG_EVERY_MS.
+     */
+    class LogEveryMsState {
+    public:
+      /**
+       * @brief Check if the period has passed since the last logged execution.
+       * @param period Minimum time between the logged executions.
+       * @returns True if it should be logged, false otherwise.
+       */
+      bool shouldLog(const std::chrono::milliseconds period) {
+        const std::int64_t now {std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()};
+        std::int64_t next_allowed {m_next_allowed.load(std::memory_order_relaxed)};
+        if (now < next_allowed) {
+          return false;
+        }
+
+        // Only a single thread wins the race
+        return m_next_allowed.compare_exchange_strong(next_allowed, now + std::chrono::duration_cast<std::chrono::nanoseconds>(period).count(), std::memory_order_relaxed);
+      }
+
+    private:
+      std::atomic<std::int64_t> m_next_allowed {std::numeric_limits<std::int64_t>::min()}; /**< Steady clock time (in ns) when logging is allowed again. */
+    };
+  }  // namespace detail
 }  // namespace display_device
 
 /**
  * @brief Helper MACRO that disables output string computation if log level is not enabled.
+ * @note Statements below the DD_LOG_COMPILE_LEVEL are discarded at compile time.
  * @examples
  * DD_LOG(info) << "Hello World!" << " " << 123;
  * DD_LOG(error) << "OH MY GAWD!";
  * @examples_end
  */
-#define DD_LOG(level) \
-  for (bool is_enabled {display_device::Logger::get().isLogLevelEnabled(display_device::Logger::LogLevel::level)}; is_enabled; is_enabled = false) \
-  display_device::LogWriter(display_device::Logger::LogLevel::level)
+#define DD_LOG(level) DD_LOG_CATEGORY(general, level)
+
+/**
+ * @brief Same as DD_LOG, but the statement is checked against the log level of the category.
+ * @examples
+ * DD_LOG_CATEGORY(edid, verbose) << "Parsing the extension block...";
+ * @examples_end
+ */
+#define DD_LOG_CATEGORY(category, level) \
+  DD_LOG_IF_CAPTURED(category, level) \
+  display_device::LogWriter(display_device::Logger::LogLevel::level, display_device::Logger::LogCategory::category)
+
+/**
+ * @brief Same as DD_LOG, but only every n-th execution of the statement is written out (starting with the first one).
+ * @note The counter is kept per call site and is only incremented if the log level is enabled.
+ * @examples
+ * DD_LOG_EVERY_N(error, 100) << "Failed to apply settings, retrying...";
+ * @examples_end
+ */
+#define DD_LOG_EVERY_N(level, n) DD_LOG_CATEGORY_EVERY_N(general, level, n)
+
+/**
+ * @brief Same as DD_LOG_EVERY_N, but the statement is checked against the log level of the category.
+ * @examples
+ * DD_LOG_CATEGORY_EVERY_N(scheduler, error, 100) << "Failed to revert settings, retrying...";
+ * @examples_end
+ */
+#define DD_LOG_CATEGORY_EVERY_N(category, level, n) \
+  DD_LOG_IF_ENABLED(category, level) \
+  if (!DD_LOG_CALL_SITE_STATE(display_device::detail::LogEveryNState).shouldLog(n)) {} \
+  else \
+    display_device::LogWriter(display_device::Logger::LogLevel::level, display_device::Logger::LogCategory::category)
+
+/**
+ * @brief Same as DD_LOG, but the statement is written out at most once per period (in milliseconds).
+ * @note The timer is kept per call site.
+ * @examples
+ * DD_LOG_EVERY_MS(error, 60000) << "Failed to apply settings, retrying...";
+ * @examples_end
+ */
+#define DD_LOG_EVERY_MS(level, period_ms) DD_LOG_CATEGORY_EVERY_MS(general, level, period_ms)
+
+/**
+ * @brief Same as DD_LOG_EVERY_MS, but the statement is checked against the log level of the category.
+ * @examples
+ * DD_LOG_CATEGORY_EVERY_MS(scheduler, error, 60000) << "Failed to revert settings, retrying...";
+ * @examples_end
+ */
+#define DD_LOG_CATEGORY_EVERY_MS(category, level, period_ms) \
+  DD_LOG_IF_ENABLED(category, level) \
+  if (!DD_LOG_CALL_SITE_STATE(display_device::detail::LogEveryMsState).shouldLog(std::chrono::milliseconds {period_ms})) {} \
+  else \
+    display_device::LogWriter(display_device::Logger::LogLevel::level, display_device::Logger::LogCategory::category)
+
+/**
+ * @brief Internal helper MACRO that creates a static state object that is unique to the call site.
+ */
+#define DD_LOG_CALL_SITE_STATE(type) \
+  ([]() -> type & { \
+    static type state; \
+    return state; \
+  }())
+
+/**
+ * @brief Same as DD_LOG, but captures the typed values into a `LogRecord` that is only formatted when needed.
+ * @examples
+ * DD_LOG_RECORD(info) << "Applying mode " << logField("width", 1920) << " " << logField("height", 1080);
+ * @examples_end
+ */
+#define DD_LOG_RECORD(level) DD_LOG_CATEGORY_RECORD(general, level)
+
+/**
+ * @brief Same as DD_LOG_RECORD, but the statement is checked against the log level of the category.
+ * @examples
+ * DD_LOG_CATEGORY_RECORD(edid, verbose) << "Parsed " << logField("extension_count", 1);
+ * @examples_end
+ */
+#define DD_LOG_CATEGORY_RECORD(category, level) \
+  DD_LOG_IF_CAPTURED(category, level) \
+  display_device::LogRecordWriter(display_device::Logger::LogLevel::level, display_device::Logger::LogCategory::category)
+
+/**
+ * @brief Internal helper MACRO that only executes the following statement if the log level is compiled in and enabled.
+ */
+#define DD_LOG_IF_ENABLED(category, level) \
+  if constexpr (static_cast<int>(display_device::Logger::LogLevel::level) < DD_LOG_COMPILE_LEVEL) {} \
+  else \
+    for (bool is_enabled {display_device::Logger::get().isLogLevelEnabled(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level)}; is_enabled; is_enabled = false)
+
+/**
+ * @brief Internal helper MACRO that only executes the following statement if the log level is compiled in and enabled
+ *        for the output or the flight recorder.
+ */
+#define DD_LOG_IF_CAPTURED(category, level) \
+  if constexpr (static_cast<int>(display_device::Logger::LogLevel::level) < DD_LOG_COMPILE_LEVEL) {} \
+  else \
+    for (bool is_captured {display_device::Logger::get().isLogLevelCaptured(display_device::Logger::LogCategory::category, display_device::Logger::LogLevel::level)}; is_captured; is_captured = false)
@@ -0,0 +1,103 @@
+/**
+ * @file src/common/include/display_device/mapped_file_sink.h
+ * @brief Declarations for the memory-mapped rotating log file.
+ */
+#pragma once
+
+// system includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+// local includes
+#include "logging.h"
+
+namespace display_device {
+  /**
+   * @brief A log sink that appends the lines to a memory-mapped file and rotates it once it is full.
+   *
+   * The writers only reserve the space with an atomic counter and copy the line into the
+   * mapping, so there are no locks or system calls per line. The data is written to the disk
+   * by the OS in the background, unless `sync` is called. Once the file is full, it is renamed
+   * to "<filename>.1" (the older backups are shifted to ".2", ".3", ...) and a new file is started.
+   *
+   * @note If the process crashes, the current file may contain zero bytes at the end,
+   *       since the file is only truncated to the written size when it is closed.
+   * @examples
+   * auto sink {std::make_shared<MappedFileSink>("display.log", 4 * 1024 * 1024, 3)};
+   * Logger::get().addSink(Logger::LogLevel::info, [sink](const Logger::LogLevel level, const std::string &value) {
+   *   sink->write(level, value);
+   * });
+   * @examples_end
+   */
+  class MappedFileSink {
+  public:
+    /**
+     * Default constructor. Creates the file and maps it into the memory.
+     * @param filepath A non-empty filepath. If the file already exists, it is rotated first.
+     * @param max_file_size Maximum size of the single file in bytes (must be non-zero).
+     * @param backup_count Number of full files to keep around.
+     * @throws std::runtime_error If the arguments are invalid or the file cannot be mapped.
+     * @warning The constructor does not create missing directories!
+     */
+    explicit MappedFileSink(std::filesystem::path filepath, std::size_t max_file_size, std::size_t backup_count);
+
+    /**
+     * @brief Unmap the file and truncate it to the written size.
+     * @warning There must be no concurrent writes.
+     */
+    ~MappedFileSink();
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    MappedFileSink(const MappedFileSink &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    MappedFileSink &operator=(const MappedFileSink &) = delete;
+
+    /**
+     * @brief Append the line with the timestamp and the level prefix (same as the standard output).
+     * @param log_level Log level of the line.
+     * @param value Text to be written. Lines that do not fit into a single file are truncated.
+     * @note Safe to call from multiple threads. If the new file could not be created during
+     *       the rotation, the lines are discarded until the next rotation attempt.
+     */
+    void write(Logger::LogLevel log_level, std::string_view value);
+
+    /**
+     * @brief Synchronously write the mapped data to the disk.
+     * @returns True on success, false otherwise.
+     */
+    [[nodiscard]] bool sync();
+
+  private:
+    class MappedFile;
+
+    /**
+     * @brief Switch to the next file once the writers that fit into the current one are done.
+     * @param state Reservation state that overflowed the current file.
+     */
+    void rotate(std::uint64_t state);
+
+    /**
+     * @brief Shift the backup files and move the current file to the first backup.
+     */
+    void rotateFiles() const;
+
+    std::filesystem::path m_filepath; /**< Path to the current log file. */
+    std::size_t m_max_file_size; /**< Maximum size of a single file. */
+    std::size_t m_backup_count; /**< Number of backups to keep. */
+    std::mutex m_rotation_mutex; /**< Serializes the rotation and syncing (writers do not use it). */
+    std::unique_ptr<MappedFile> m_file; /**< Currently mapped file (null if the last rotation failed). */
+    char *m_data {nullptr}; /**< Mapped memory of the current file (only changed once all of its writers are done). */
+    std::atomic<std::uint64_t> m_state {0}; /**< Generation of the file (upper bits) and the reserved size (lower bits). */
+    std::atomic<std::size_t> m_committed_size {0}; /**< Number of bytes that are fully copied into the current file. */
+  };
+}  // namespace display_device
@@ -0,0 +1,21 @@
+/**
+ * @file src/common/include/display_device/pnp_vendor.h
+ * @brief Declarations for the PNP manufacturer name lookup.
+ */
+#pragma once
+
+// system includes
+#include <string_view>
+
+namespace display_device {
+  /**
+   * @brief Get the vendor name for the 3-letter PNP manufacturer ID.
+   * @param pnp_id PNP ID, for example `EdidData::m_manufacturer_id`.
+   * @returns Vendor name or an empty string if the ID is not in the compiled-in table.
+   * @note The table is generated at compile time and the lookup is O(1).
+   * @examples
+   * const auto name {getPnpVendorName(edid.m_manufacturer_id.view())};  // "ASUSTeK Computer Inc."
+   * @examples_end
+   */
+  [[nodiscard]] std::string_view getPnpVendorName(std::string_view pnp_id);
+}  // namespace display_device
@@ -6,13 +6,29 @@
 
 // system includes
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <utility>
+#include <vector>
 
 // local includes
+#include "backoff_policy.h"
 #include "logging.h"
+#include "scheduler_timer_service.h"
 
 namespace display_device {
   /**
@@ -114,8 +130,59 @@ namespace display_device {
      */
     template<class T, class FunctionT>
     concept ExecuteCallbackLike = ExecuteWithoutStopToken<T, FunctionT> || ExecuteWithStopToken<T, FunctionT>;
+
+    /**
+     * @brief Value returned by the RetryScheduler::execute for the function.
+     */
+    template<class T, class FunctionT>
+    using execute_result_t = std::remove_cvref_t<typename std::conditional_t<ExecuteWithStopToken<T, FunctionT>, std::invoke_result<FunctionT, T &, SchedulerStopToken &>, std::invoke_result<FunctionT, T &>>::type>;
+
+    /**
+     * @brief Result of the asynchronous call that is handed over to the awaiting coroutine.
+     */
+    template<class R>
+    struct AsyncResult {
+      std::optional<R> m_value; /**< Value returned by the call. */
+      std::exception_ptr m_exception; /**< Exception thrown by the call. */
+
+      /**
+       * @brief Take the value or rethrow the exception.
+       */
+      R take() {
+        if (m_exception) {
+          std::rethrow_exception(m_exception);
+        }
+        return std::move(*m_value);
+      }
+    };
+
+    template<>
+    struct AsyncResult<void> {
+      std::exception_ptr m_exception; /**< Exception thrown by the call. */
+
+      /**
+       * @brief Rethrow the exception (if any).
+       */
+      void take() const {
+        if (m_exception) {
+          std::rethrow_exception(m_exception);
+        }
+      }
+    };
   }  // namespace detail
 
+  /**
+   * @brief Posts the function to be executed elsewhere (e.g. on the caller's event loop).
+   * @note The function must not be executed inline, otherwise the awaiting coroutine
+   *       is resumed on the scheduler thread while the interface is still locked.
+   * @examples
+   * const SchedulerExecutor executor {[&io_context](std::function<void()> fn) {
+   *   boost::asio::post(io_context, std::move(fn));
+   * }};
+   * @examples_end
+   */
+  using SchedulerExecutor = std::function<void(std::function<void()>)>;
+
   /**
    * @brief Scheduler options to be used when scheduling executor function.
    */
@@ -125,77 +192,333 @@ namespace display_device {
      */
     enum class Execution {
       Immediate,  ///< Executor is executed in the calling thread immediately and scheduled afterward.
-      ImmediateWithSleep,  ///< The first sleep duration is TAKEN from `m_sleep_durations` and the calling thread is put to sleep. Once awoken, follows by same logic as `Immediate`.
+      ImmediateWithSleep,  ///< The first sleep duration is TAKEN from the sleep durations (or the backoff policy) and the calling thread is put to sleep. Once awoken, follows by same logic as `Immediate`.
       ScheduledOnly  ///< Executor is executed in the thread only.
     };
 
-    std::vector<std::chrono::milliseconds> m_sleep_durations;  ///< Specifies for long the scheduled thread sleeps before invoking executor. Last duration is reused indefinitely.
+    std::vector<std::chrono::milliseconds> m_sleep_durations {};  ///< Specifies for long the scheduled thread sleeps before invoking executor. Last duration is reused indefinitely. Same as the `ListBackoff` policy.
+    std::optional<BackoffPolicy> m_backoff_policy {};  ///< Policy for calculating the sleep durations lazily (used instead of `m_sleep_durations`, which must be empty then).
     Execution m_execution {Execution::Immediate};  ///< Executor's execution logic.
   };
 
   /**
    * @brief A wrapper class around an interface that provides a thread-safe access to the
    *        interface and allows to schedule arbitrary logic for it to retry until it succeeds.
-   * @note The scheduler is designed to only schedule 1 callback at a time, until it is either
-   *       replaced or stopped.
+   *
+   * Multiple independent tasks can be scheduled by giving them different names. All of them
+   * are executed by the same thread, in the order of their deadlines (kept in a min-heap).
+   * The thread is either owned by the scheduler or shared with other schedulers via the
+   * SchedulerTimerService.
+   *
+   * Besides the blocking `execute`, the interface can be accessed via the future-returning
+   * `executeAsync` or from coroutines via the awaitable `executeAsync` and `retryUntil`.
+   * The calls are queued without locking the interface and are executed by the scheduler
+   * thread in between the tasks. Scheduling a task with an existing name replaces it.
    */
   template<class T>
   class RetryScheduler final {
   public:
     /**
-     * @brief Default constructor.
-     * @param iface Interface to be passed around to the executor functions.
+     * @brief Awaitable that executes the function on the scheduler thread.
+     * @note The queued call only owns the shared state, so the awaiting coroutine may be destroyed
+     *       while suspended. The function is then no longer executed (if it was not already)
+     *       and the coroutine is not resumed.
+     * @see RetryScheduler::executeAsync
      */
-    explicit RetryScheduler(std::unique_ptr<T> iface):
-        m_iface {iface ? std::move(iface) : throw std::logic_error {"Nullptr interface provided in RetryScheduler!"}},
-        m_thread {[this]() {
-          std::unique_lock lock {m_mutex};
-          while (m_keep_alive) {
-            m_syncing_thread = false;
-            if (auto duration {takeNextDuration(m_sleep_durations)}; duration > std::chrono::milliseconds::zero()) {
-              // We're going to sleep until manually woken up or the time elapses.
-              m_sleep_cv.wait_for(lock, duration, [this]() {
-                return m_syncing_thread;
-              });
+    template<class FunctionT>
+    class ExecuteAwaitable final {
+    public:
+      using ResultT = detail::execute_result_t<T, FunctionT &>; /**< Value returned from the `co_await`. */
+
+      /**
+       * @brief Default constructor.
+       * @param scheduler Scheduler to execute the function in.
+       * @param exec_fn Function to be executed.
+       * @param executor Executor to resume the awaiting coroutine on.
+       */
+      ExecuteAwaitable(RetryScheduler &scheduler, FunctionT exec_fn, SchedulerExecutor executor):
+          m_scheduler {scheduler},
+          m_state {std::make_shared<State>(std::move(exec_fn), std::move(executor))} {
+      }
+
+      /**
+       * @brief Marks the call as cancelled if the coroutine is destroyed before being resumed.
+       */
+      ~ExecuteAwaitable() {
+        m_state->m_cancelled = true;
+      }
+
+      /**
+       * @brief Deleted copy constructor.
+       */
+      ExecuteAwaitable(const ExecuteAwaitable &) = delete;
+
+      /**
+       * @brief Deleted copy operator.
+       */
+      ExecuteAwaitable &operator=(const ExecuteAwaitable &) = delete;
+
+      /**
+       * @brief The call is always queued.
+       */
+      [[nodiscard]] bool await_ready() const noexcept {
+        return false;
+      }
+
+      /**
+       * @brief Queue the call that resumes the coroutine once done.
+       */
+      void await_suspend(std::coroutine_handle<> handle) {
+        m_scheduler.enqueueCall([&scheduler = m_scheduler, state = m_state, handle]() {
+          if (state->m_cancelled) {
+            return;
+          }
+
+          try {
+            if constexpr (std::is_void_v<ResultT>) {
+              executeUnlockedImpl(scheduler, state->m_exec_fn);
             } else {
-              // We're going to sleep until manually woken up.
-              m_sleep_cv.wait(lock, [this]() {
-                return m_syncing_thread;
-              });
+              state->m_result.m_value.emplace(executeUnlockedImpl(scheduler, state->m_exec_fn));
             }
-
-            if (m_syncing_thread) {
-              // Thread was waken up to sync sleep time or to be stopped.
-              continue;
+          } catch (...) {
+            state->m_result.m_exception = std::current_exception();
+          }
+          state->m_executor([state, handle]() {
+            if (!state->m_cancelled) {
+              handle.resume();
             }
+          });
+        });
+      }
+
+      /**
+       * @brief Get the value returned from the function or rethrow its exception.
+       */
+      ResultT await_resume() {
+        return m_state->m_result.take();
+      }
+
+    private:
+      /**
+       * @brief State shared with the queued call, which may outlive the awaitable.
+       */
+      struct State {
+        FunctionT m_exec_fn; /**< Function to be executed. */
+        SchedulerExecutor m_executor; /**< Executor to resume the coroutine on. */
+        detail::AsyncResult<ResultT> m_result; /**< Result of the function. */
+        std::atomic<bool> m_cancelled {false}; /**< Set once the awaitable is destroyed. */
+
+        State(FunctionT exec_fn, SchedulerExecutor executor):
+            m_exec_fn {std::move(exec_fn)},
+            m_executor {std::move(executor)} {
+        }
+      };
+
+      RetryScheduler &m_scheduler;
+      std::shared_ptr<State> m_state;
+    };
 
-            try {
-              SchedulerStopToken scheduler_stop_token {[&]() {
-                clearThreadLoopUnlocked();
-              }};
-              m_retry_function(*m_iface, scheduler_stop_token);
-              continue;
-            } catch (const std::exception &error) {
-              DD_LOG(error) << "Exception thrown in the RetryScheduler thread. Stopping scheduler. Error:\n"
-                            << error.what();
+    /**
+     * @brief Awaitable that retries the function on the scheduler thread until it succeeds.
+     * @note The retry task only owns the shared state, so the awaiting coroutine may be destroyed
+     *       while suspended. The task then stops itself before its next attempt and the coroutine
+     *       is not resumed.
+     * @see RetryScheduler::retryUntil
+     */
+    class RetryAwaitable final {
+    public:
+      /**
+       * @brief Default constructor.
+       * @param scheduler Scheduler to execute the function in.
+       * @param name Name of the retry task.
+       * @param exec_fn Function to be retried until it returns true.
+       * @param backoff_policy Policy for the sleep durations between the retries.
+       * @param executor Executor to resume the awaiting coroutine on.
+       */
+      RetryAwaitable(RetryScheduler &scheduler, std::string name, std::function<bool(T &)> exec_fn, BackoffPolicy backoff_policy, SchedulerExecutor executor):
+          m_scheduler {scheduler},
+          m_name {std::move(name)},
+          m_state {std::make_shared<State>(std::move(exec_fn), std::move(backoff_policy), std::move(executor))} {
+      }
+
+      /**
+       * @brief Marks the retries as cancelled if the coroutine is destroyed before being resumed.
+       */
+      ~RetryAwaitable() {
+        m_state->m_cancelled = true;
+      }
+
+      /**
+       * @brief Deleted copy constructor.
+       */
+      RetryAwaitable(const RetryAwaitable &) = delete;
+
+      /**
+       * @brief Deleted copy operator.
+       */
+      RetryAwaitable &operator=(const RetryAwaitable &) = delete;
+
+      /**
+       * @brief Get the name of the retry task, which can be passed to `stop` to stop the retries.
+       * @returns Name of the task.
+       */
+      [[nodiscard]] const std::string &getTaskName() const {
+        return m_name;
+      }
+
+      /**
+       * @brief The call is always queued.
+       */
+      [[nodiscard]] bool await_ready() const noexcept {
+        return false;
+      }
+
+      /**
+       * @brief Queue the call that schedules the retries and resumes the coroutine once done.
+       */
+      void await_suspend(std::coroutine_handle<> handle) {
+        m_scheduler.enqueueCall([&scheduler = m_scheduler, name = m_name, state = m_state, handle]() mutable {
+          if (state->m_cancelled) {
+            return;
+          }
+
+          // The coroutine is also resumed once the task is stopped or replaced without succeeding
+          // (the last copy of the completion is destroyed together with the task function).
+          const auto completion {std::make_shared<Completion>(state, handle)};
+          scheduler.scheduleUnlocked(std::move(name), [state, completion](T &iface, SchedulerStopToken &stop_token) {
+            if (!state->m_cancelled) {
+              try {
+                if (!state->m_exec_fn(iface)) {
+                  return;
+                }
+                state->m_succeeded = true;
+              } catch (...) {
+                state->m_exception = std::current_exception();
+              }
             }
+            stop_token.requestStop();
+            completion->resume();
+          },
+                                     {.m_backoff_policy = state->m_backoff_policy});
+        });
+      }
+
+      /**
+       * @brief Get the result of retries or rethrow the exception from the function.
+       * @returns True if the function has succeeded, false if the retries were stopped.
+       */
+      bool await_resume() const {
+        if (m_state->m_exception) {
+          std::rethrow_exception(m_state->m_exception);
+        }
+        return m_state->m_succeeded;
+      }
+
+    private:
+      /**
+       * @brief State shared with the retry task, which may outlive the awaitable.
+       */
+      struct State {
+        std::function<bool(T &)> m_exec_fn; /**< Function to be retried. */
+        BackoffPolicy m_backoff_policy; /**< Policy for the sleep durations between the retries. */
+        SchedulerExecutor m_executor; /**< Executor to resume the coroutine on. */
+        bool m_succeeded {false}; /**< Whether the function has succeeded. */
+        std::exception_ptr m_exception; /**< Exception thrown by the function. */
+        std::atomic<bool> m_cancelled {false}; /**< Set once the awaitable is destroyed. */
+
+        State(std::function<bool(T &)> exec_fn, BackoffPolicy backoff_policy, SchedulerExecutor executor):
+            m_exec_fn {std::move(exec_fn)},
+            m_backoff_policy {std::move(backoff_policy)},
+            m_executor {std::move(executor)} {
+        }
+      };
+
+      /**
+       * @brief Resumes the coroutine exactly once (unless it was destroyed in the meantime).
+       */
+      struct Completion {
+        std::shared_ptr<State> m_state; /**< State of the awaitable. */
+        std::coroutine_handle<> m_handle; /**< Awaiting coroutine. */
+        bool m_resumed {false}; /**< Whether the coroutine was already resumed. */
+
+        Completion(std::shared_ptr<State> state, const std::coroutine_handle<> handle):
+            m_state {std::move(state)},
+            m_handle {handle} {
+        }
+
+        Completion(const Completion &) = delete;
+        Completion &operator=(const Completion &) = delete;
 
-            clearThreadLoopUnlocked();
+        ~Completion() {
+          resume();
+        }
+
+        void resume() {
+          if (!std::exchange(m_resumed, true) && !m_state->m_cancelled) {
+            m_state->m_executor([state = m_state, handle = m_handle]() {
+              if (!state->m_cancelled) {
+                handle.resume();
+              }
+            });
           }
-        }} {
+        }
+      };
+
+      RetryScheduler &m_scheduler;
+      std::string m_name;
+      std::shared_ptr<State> m_state;
+    };
+
+    /**
+     * @brief Default constructor.
+     * @param iface Interface to be passed around to the executor functions.
+     * @param timer_service Optional timer service to execute the tasks in instead of a dedicated thread.
+     * @note The interface access is serialized the same way whether the timer service is shared or not.
+     * @examples
+     * RetryScheduler<SettingsManagerInterface> scheduler{getIface(...)};
+     *
+     * const auto timer_service {std::make_shared<SchedulerTimerService>()};
+     * RetryScheduler<SettingsManagerInterface> shared_scheduler_a{getIface(...), timer_service};
+     * RetryScheduler<SettingsManagerInterface> shared_scheduler_b{getIface(...), timer_service};
+     * @examples_end
+     */
+    explicit RetryScheduler(std::unique_ptr<T> iface, std::shared_ptr<SchedulerTimerService> timer_service = nullptr):
+        m_iface {iface ? std::move(iface) : throw std::logic_error {"Nullptr interface provided in RetryScheduler!"}},
+        m_timer_service {std::move(timer_service)},
+        m_thread {m_timer_service ? std::thread {} : std::thread {[this]() {
+          runThread();
+        }}} {
+      if (m_timer_service) {
+        m_client_id = m_timer_service->registerClient([this]() {
+          std::lock_guard lock {m_mutex};
+          return runNextUnlocked();
+        });
+      }
     }
 
     /**
-     * @brief A destructor that gracefully shuts down the thread.
+     * @brief A destructor that gracefully shuts down the thread or unregisters from the timer service.
+     * @note In both cases it waits for the currently running task to finish. The remaining queued
+     *       calls are then executed by the destructor, so that no awaiting coroutine is left hanging.
      */
     ~RetryScheduler() {
-      {
-        std::lock_guard lock {m_mutex};
-        m_keep_alive = false;
-        syncThreadUnlocked();
+      if (m_timer_service) {
+        m_timer_service->unregisterClient(m_client_id);
+      } else {
+        {
+          std::lock_guard lock {m_queue_mutex};
+          m_keep_alive = false;
+          m_syncing_thread = true;
+          m_sleep_cv.notify_one();
+        }
+
+        m_thread.join();
       }
 
-      m_thread.join();
+      std::lock_guard lock {m_mutex};
+      while (runQueuedCallUnlocked()) {
+        // Keep draining the queue
+      }
     }
 
     /**
@@ -204,7 +527,7 @@ namespace display_device {
      *                It accepts a `stop_token` as a second parameter which can be used to stop
      *                the scheduler.
      * @param options Options for the scheduler.
-     * @note Previously scheduled executor is replaced by a new one!
+     * @note Previously scheduled (unnamed) executor is replaced by a new one!
      * @examples
      * std::unique_ptr<SettingsManagerInterface> iface = getIface(...);
      * RetryScheduler<SettingsManagerInterface> scheduler{std::move(iface)};
@@ -217,47 +540,55 @@ namespace display_device {
      * @examples_end
      */
     void schedule(std::function<void(T &, SchedulerStopToken &stop_token)> exec_fn, const SchedulerOptions &options) {
+      schedule(std::string {}, std::move(exec_fn), options);
+    }
+
+    /**
+     * @brief Schedule a named interface executor function to be executed at specified intervals.
+     * @param name Name of the task. The unnamed `schedule` overload uses an empty name.
+     * @param exec_fn Provides thread-safe access to the interface for executing arbitrary logic.
+     *                It accepts a `stop_token` as a second parameter which can be used to stop
+     *                this task (other tasks are not affected).
+     * @param options Options for the scheduler.
+     * @note Previously scheduled executor with the same name is replaced by a new one!
+     * @examples
+     * scheduler.schedule("revert", [](SettingsManagerInterface& iface, SchedulerStopToken& stop_token){
+     *   if (iface.revertSettings()) {
+     *     stop_token.requestStop();
+     *   }
+     * }, { .m_sleep_durations = { 50ms, 10ms });
+     * scheduler.schedule("hdr_blank", [](SettingsManagerInterface& iface, SchedulerStopToken& stop_token){
+     *   // ...
+     * }, { .m_backoff_policy = ExponentialBackoff { .m_initial = 100ms, .m_multiplier = 2.0, .m_max = 30s } });
+     * @examples_end
+     */
+    void schedule(std::string name, std::function<void(T &, SchedulerStopToken &stop_token)> exec_fn, const SchedulerOptions &options) {
       if (!exec_fn) {
         throw std::logic_error {"Empty callback function provided in RetryScheduler::schedule!"};
       }
 
-      if (options.m_sleep_durations.empty()) {
-        throw std::logic_error {"At least 1 sleep duration must be specified in RetryScheduler::schedule!"};
-      }
-
-      if (std::ranges::any_of(options.m_sleep_durations, [&](const auto &duration) {
-            return duration == std::chrono::milliseconds::zero();
-          })) {
-        throw std::logic_error {"All of the durations specified in RetryScheduler::schedule must be larger than a 0!"};
-      }
-
-      std::lock_guard lock {m_mutex};
-      SchedulerStopToken stop_token {[&]() {
-        stopUnlocked();
-      }};
-
-      // We are catching the exception here instead of propagating to have
-      // similar try...catch login as in the scheduler thread.
-      try {
-        auto sleep_durations = options.m_sleep_durations;
-        if (options.m_execution != SchedulerOptions::Execution::ScheduledOnly) {
-          if (options.m_execution == SchedulerOptions::Execution::ImmediateWithSleep) {
-            std::this_thread::sleep_for(takeNextDuration(sleep_durations));
-          }
+      if (options.m_backoff_policy) {
+        if (!options.m_sleep_durations.empty()) {
+          throw std::logic_error {"Both the sleep durations and the backoff policy are specified in RetryScheduler::schedule!"};
+        }
 
-          exec_fn(*m_iface, stop_token);
+        if (!isValidBackoffPolicy(*options.m_backoff_policy)) {
+          throw std::logic_error {"Invalid backoff policy specified in RetryScheduler::schedule!"};
+        }
+      } else {
+        if (options.m_sleep_durations.empty()) {
+          throw std::logic_error {"At least 1 sleep duration must be specified in RetryScheduler::schedule!"};
         }
 
-        if (!stop_token.stopRequested()) {
-          m_retry_function = std::move(exec_fn);
-          m_sleep_durations = std::move(sleep_durations);
-          syncThreadUnlocked();
+        if (std::ranges::any_of(options.m_sleep_durations, [&](const auto &duration) {
+              return duration <= std::chrono::milliseconds::zero();
+            })) {
+          throw std::logic_error {"All of the durations specified in RetryScheduler::schedule must be larger than a 0!"};
         }
-      } catch (const std::exception &error) {
-        stop_token.requestStop();
-        DD_LOG(error) << "Exception thrown in the RetryScheduler::schedule. Stopping scheduler. Error:\n"
-                      << error.what();
       }
+
+      std::lock_guard lock {m_mutex};
+      scheduleUnlocked(std::move(name), std::move(exec_fn), options);
     }
 
     /**
@@ -276,32 +607,234 @@ namespace display_device {
       return executeImpl(*this, std::forward<FunctionT>(exec_fn));
     }
 
+    /**
+     * @brief Execute arbitrary logic using the provided interface on the scheduler thread
+     *        without blocking the caller.
+     * @param exec_fn Function with the same signature as for the `execute` method.
+     * @returns Future for the value returned from the function (or its exception).
+     * @note The function is executed in between the scheduled tasks, therefore it is serialized
+     *       with them and with the `execute` calls. Multiple calls are executed in the order
+     *       they were made.
+     * @examples
+     * auto primary_future = scheduler.executeAsync([](SettingsManagerInterface& iface) {
+     *   return iface.isPrimary(device_id_a);
+     * });
+     * auto name_future = scheduler.executeAsync([](SettingsManagerInterface& iface) {
+     *   return iface.getDisplayName(device_id_b);
+     * });
+     * const bool is_primary = primary_future.get();
+     * const auto display_name = name_future.get();
+     * @examples_end
+     */
+    template<class FunctionT>
+    [[nodiscard]] std::future<detail::execute_result_t<T, std::decay_t<FunctionT> &>> executeAsync(FunctionT &&exec_fn)
+      requires detail::ExecuteCallbackLike<T, std::decay_t<FunctionT> &>
+    {
+      using ResultT = detail::execute_result_t<T, std::decay_t<FunctionT> &>;
+
+      if constexpr (detail::OptionalFunction<FunctionT>) {
+        if (!exec_fn) {
+          throw std::logic_error {"Empty callback function provided in RetryScheduler::executeAsync!"};
+        }
+      }
+
+      // The queued calls must be copyable, therefore the task is shared
+      const auto task {std::make_shared<std::packaged_task<ResultT()>>([this, exec_fn = std::forward<FunctionT>(exec_fn)]() mutable {
+        return executeUnlockedImpl(*this, exec_fn);
+      })};
+      auto future {task->get_future()};
+      enqueueCall([task]() {
+        (*task)();
+      });
+      return future;
+    }
+
+    /**
+     * @brief Execute arbitrary logic using the provided interface on the scheduler thread
+     *        without blocking the caller and resume the awaiting coroutine afterward.
+     * @param exec_fn Function with the same signature as for the `execute` method.
+     * @param executor Executor to resume the awaiting coroutine on.
+     * @returns Awaitable for the value returned from the function (the exception is rethrown).
+     * @note The function is executed in between the scheduled tasks, therefore it is serialized
+     *       with them and with the `execute` calls.
+     * @warning The returned awaitable must be awaited exactly once.
+     * @examples
+     * const auto display_name = co_await scheduler.executeAsync([&](SettingsManagerInterface& iface) {
+     *   return iface.getDisplayName(device_id);
+     * }, executor);
+     * @examples_end
+     */
+    template<class FunctionT>
+    [[nodiscard]] ExecuteAwaitable<std::decay_t<FunctionT>> executeAsync(FunctionT &&exec_fn, SchedulerExecutor executor)
+      requires detail::ExecuteCallbackLike<T, std::decay_t<FunctionT> &>
+    {
+      if constexpr (detail::OptionalFunction<FunctionT>) {
+        if (!exec_fn) {
+          throw std::logic_error {"Empty callback function provided in RetryScheduler::executeAsync!"};
+        }
+      }
+
+      if (!executor) {
+        throw std::logic_error {"Empty executor provided in RetryScheduler::executeAsync!"};
+      }
+
+      return {*this, std::forward<FunctionT>(exec_fn), std::move(executor)};
+    }
+
+    /**
+     * @brief Retry the function on the scheduler thread until it succeeds without blocking the caller.
+     * @param exec_fn Function to be retried until it returns true. The first attempt is made immediately.
+     * @param backoff_policy Policy for the sleep durations between the retries.
+     * @param executor Executor to resume the awaiting coroutine on.
+     * @returns Awaitable for the result - true if the function has succeeded, false if the retries
+     *          were stopped before that (via `stop` or the destructor). The exception is rethrown.
+     * @note The retries are scheduled as a task with a unique name "retryUntil#<id>",
+     *       which is available via `RetryAwaitable::getTaskName`.
+     * @warning The returned awaitable must be awaited exactly once.
+     * @examples
+     * auto revert = scheduler.retryUntil([](SettingsManagerInterface& iface) {
+     *   return iface.revertSettings();
+     * }, ExponentialBackoff { .m_initial = 100ms, .m_multiplier = 2.0, .m_max = 30s }, executor);
+     * revert_task_name = revert.getTaskName();  // To stop it later via scheduler.stop(revert_task_name)
+     * const bool reverted = co_await revert;
+     * @examples_end
+     */
+    [[nodiscard]] RetryAwaitable retryUntil(std::function<bool(T &)> exec_fn, BackoffPolicy backoff_policy, SchedulerExecutor executor) {
+      auto name {"retryUntil#" + std::to_string(m_next_retry_id.fetch_add(1, std::memory_order_relaxed))};
+      return retryUntil(std::move(name), std::move(exec_fn), std::move(backoff_policy), std::move(executor));
+    }
+
+    /**
+     * @brief Retry the function on the scheduler thread until it succeeds as the named task.
+     * @param name Name of the retry task, which can be passed to `stop` to stop the retries.
+     * @param exec_fn Function to be retried until it returns true. The first attempt is made immediately.
+     * @param backoff_policy Policy for the sleep durations between the retries.
+     * @param executor Executor to resume the awaiting coroutine on.
+     * @returns Awaitable for the result (see the unnamed overload).
+     * @note Previously scheduled task with the same name is replaced (and vice versa)!
+     * @warning The returned awaitable must be awaited exactly once.
+     * @examples
+     * const bool reverted = co_await scheduler.retryUntil("revert", [](SettingsManagerInterface& iface) {
+     *   return iface.revertSettings();
+     * }, ExponentialBackoff { .m_initial = 100ms, .m_multiplier = 2.0, .m_max = 30s }, executor);
+     *
+     * // Elsewhere
+     * scheduler.stop("revert");
+     * @examples_end
+     */
+    [[nodiscard]] RetryAwaitable retryUntil(std::string name, std::function<bool(T &)> exec_fn, BackoffPolicy backoff_policy, SchedulerExecutor executor) {
+      if (!exec_fn) {
+        throw std::logic_error {"Empty callback function provided in RetryScheduler::retryUntil!"};
+      }
+
+      if (!isValidBackoffPolicy(backoff_policy)) {
+        throw std::logic_error {"Invalid backoff policy specified in RetryScheduler::retryUntil!"};
+      }
+
+      if (!executor) {
+        throw std::logic_error {"Empty executor provided in RetryScheduler::retryUntil!"};
+      }
+
+      return {*this, std::move(name), std::move(exec_fn), std::move(backoff_policy), std::move(executor)};
+    }
+
     /**
      * @brief Check whether anything is scheduled for execution.
      * @return True if something is scheduled, false otherwise.
      */
     [[nodiscard]] bool isScheduled() const {
-      return static_cast<bool>(m_retry_function);
+      return m_task_count.load(std::memory_order_relaxed) > 0;
     }
 
     /**
-     * @brief Stop the scheduled function - will no longer be execute once THIS method returns.
+     * @brief Check whether the named task is scheduled for execution.
+     * @param name Name of the task.
+     * @return True if the task is scheduled, false otherwise.
+     * @warning Must not be called from within the executor functions.
+     */
+    [[nodiscard]] bool isScheduled(const std::string_view name) const {
+      std::lock_guard lock {m_mutex};
+      return m_tasks.contains(name);
+    }
+
+    /**
+     * @brief Stop all of the scheduled functions - will no longer be execute once THIS method returns.
      */
     void stop() {
       std::lock_guard lock {m_mutex};
       stopUnlocked();
     }
 
+    /**
+     * @brief Stop the named task - will no longer be execute once THIS method returns.
+     * @param name Name of the task.
+     */
+    void stop(const std::string_view name) {
+      std::lock_guard lock {m_mutex};
+      stopTaskUnlocked(name);
+    }
+
   private:
-    static std::chrono::milliseconds takeNextDuration(std::vector<std::chrono::milliseconds> &durations) {
-      if (durations.size() > 1) {
-        const auto front_it {std::begin(durations)};
-        const auto front_value {*front_it};
-        durations.erase(front_it);
-        return front_value;
+    /**
+     * @brief Scheduled executor function with its own sleep durations.
+     */
+    struct Task {
+      std::uint64_t m_id {0}; /**< Unique id to detect the stale deadlines of replaced tasks. */
+      std::function<void(T &, SchedulerStopToken &)> m_retry_function {nullptr}; /**< Function to be executed until it succeeds. */
+      BackoffPolicy m_backoff_policy; /**< Sleep times for the timer. */
+    };
+
+    /**
+     * @brief Next execution time of the task.
+     */
+    struct Deadline {
+      std::chrono::steady_clock::time_point m_time; /**< When to execute the task. */
+      std::uint64_t m_task_id; /**< Id of the task when the deadline was added. */
+      std::string m_name; /**< Name of the task. */
+
+      /**
+       * @brief Comparator for the min-heap.
+       */
+      friend bool operator>(const Deadline &lhs, const Deadline &rhs) {
+        return lhs.m_time > rhs.m_time;
       }
+    };
 
-      return durations.empty() ? std::chrono::milliseconds::zero() : durations.back();
+    /**
+     * @brief Schedule the executor function while the mutex is already locked.
+     * @see RetryScheduler::schedule
+     */
+    void scheduleUnlocked(std::string name, std::function<void(T &, SchedulerStopToken &stop_token)> exec_fn, const SchedulerOptions &options) {
+      SchedulerStopToken stop_token {[&]() {
+        stopTaskUnlocked(name);
+      }};
+
+      // We are catching the exception here instead of propagating to have
+      // similar try...catch login as in the scheduler thread.
+      try {
+        auto backoff_policy {options.m_backoff_policy ? *options.m_backoff_policy : ListBackoff {.m_durations = options.m_sleep_durations}};
+        if (options.m_execution != SchedulerOptions::Execution::ScheduledOnly) {
+          if (options.m_execution == SchedulerOptions::Execution::ImmediateWithSleep) {
+            std::this_thread::sleep_for(takeNextDuration(backoff_policy));
+          }
+
+          exec_fn(*m_iface, stop_token);
+        }
+
+        if (!stop_token.stopRequested()) {
+          auto &task {m_tasks[name]};
+          task.m_id = m_next_task_id++;
+          task.m_retry_function = std::move(exec_fn);
+          task.m_backoff_policy = std::move(backoff_policy);
+          pushDeadlineUnlocked(name, task);
+          m_task_count.store(m_tasks.size(), std::memory_order_relaxed);
+          syncThreadUnlocked();
+        }
+      } catch (const std::exception &error) {
+        stop_token.requestStop();
+        DD_LOG_CATEGORY(scheduler, error) << "Exception thrown in the RetryScheduler::schedule. Stopping scheduler. Error:\n"
+                                          << error.what();
+      }
     }
 
     /**
@@ -344,7 +877,6 @@ namespace display_device {
       requires detail::ExecuteCallbackLike<T, decltype(exec_fn)>
     {
       using FunctionT = decltype(exec_fn);
-      constexpr bool IsConst = std::is_const_v<std::remove_reference_t<decltype(self)>>;
 
       if constexpr (detail::OptionalFunction<FunctionT>) {
         if (!exec_fn) {
@@ -353,6 +885,19 @@ namespace display_device {
       }
 
       std::lock_guard lock {self.m_mutex};
+      return executeUnlockedImpl(self, std::forward<FunctionT>(exec_fn));
+    }
+
+    /**
+     * @brief Execute the function while the mutex is already locked.
+     * @see RetryScheduler::executeImpl
+     */
+    static auto executeUnlockedImpl(auto &self, auto &&exec_fn)
+      requires detail::ExecuteCallbackLike<T, decltype(exec_fn)>
+    {
+      using FunctionT = decltype(exec_fn);
+      constexpr bool IsConst = std::is_const_v<std::remove_reference_t<decltype(self)>>;
+
       detail::auto_const_t<std::decay_t<T>, IsConst> &iface_ref {*self.m_iface};
       if constexpr (detail::ExecuteWithStopToken<T, FunctionT>) {
         detail::auto_const_t<SchedulerStopToken, IsConst> stop_token {[&self]() {
@@ -367,39 +912,217 @@ namespace display_device {
     }
 
     /**
-     * @brief Clear the necessary data so that the thread will go into a deep sleep.
+     * @brief Loop of the dedicated scheduler thread.
+     */
+    void runThread() {
+      std::unique_lock queue_lock {m_queue_mutex};
+      while (m_keep_alive) {
+        m_syncing_thread = false;
+        queue_lock.unlock();
+        const auto next_deadline {[this]() {
+          std::lock_guard lock {m_mutex};
+          return runNextUnlocked();
+        }()};
+        queue_lock.lock();
+
+        if (!next_deadline) {
+          // We're going to sleep until manually woken up.
+          m_sleep_cv.wait(queue_lock, [this]() {
+            return m_syncing_thread;
+          });
+        } else {
+          // We're going to sleep until manually woken up or the earliest deadline is reached.
+          m_sleep_cv.wait_until(queue_lock, *next_deadline, [this]() {
+            return m_syncing_thread;
+          });
+        }
+      }
+    }
+
+    /**
+     * @brief Execute the next queued call or, if there are none, the earliest task if its deadline is reached.
+     * @returns The time when this method should be called again (if ever).
+     * @note At most one call or task is executed so that the mutex can be released in between.
+     */
+    std::optional<std::chrono::steady_clock::time_point> runNextUnlocked() {
+      if (!runQueuedCallUnlocked()) {
+        dropStaleDeadlinesUnlocked();
+        if (!m_deadlines.empty() && m_deadlines.front().m_time <= std::chrono::steady_clock::now()) {
+          runDueTaskUnlocked();
+        }
+      }
+
+      std::lock_guard lock {m_queue_mutex};
+      return nextDeadlineUnlocked();
+    }
+
+    /**
+     * @brief Execute the earliest task (its deadline must be reached).
+     */
+    void runDueTaskUnlocked() {
+      std::ranges::pop_heap(m_deadlines, std::greater {});
+      const auto deadline {std::move(m_deadlines.back())};
+      m_deadlines.pop_back();
+
+      // The deadline at the top is never stale after dropping them
+      auto &task {m_tasks.find(deadline.m_name)->second};
+      try {
+        SchedulerStopToken scheduler_stop_token {[&]() {
+          stopTaskUnlocked(deadline.m_name);
+        }};
+        task.m_retry_function(*m_iface, scheduler_stop_token);
+        if (!scheduler_stop_token.stopRequested()) {
+          pushDeadlineUnlocked(deadline.m_name, task);
+        }
+      } catch (const std::exception &error) {
+        DD_LOG_CATEGORY(scheduler, error) << "Exception thrown in the RetryScheduler thread. Stopping scheduler. Error:\n"
+                                          << error.what();
+        stopTaskUnlocked(deadline.m_name);
+      }
+    }
+
+    /**
+     * @brief Execute the next queued call (if any).
+     * @returns True if the call was executed, false if the queue is empty.
+     */
+    bool runQueuedCallUnlocked() {
+      std::function<void()> call;
+      {
+        std::lock_guard lock {m_queue_mutex};
+        if (m_queued_calls.empty()) {
+          return false;
+        }
+
+        call = std::move(m_queued_calls.front());
+        m_queued_calls.pop_front();
+      }
+
+      try {
+        call();
+      } catch (const std::exception &error) {
+        DD_LOG_CATEGORY(scheduler, error) << "Exception thrown in the RetryScheduler queued call. Error:\n"
+                                          << error.what();
+      }
+      return true;
+    }
+
+    /**
+     * @brief Add the call to the queue and wake up the thread without locking the interface mutex.
      */
-    void clearThreadLoopUnlocked() {
-      m_sleep_durations = {};
-      m_retry_function = nullptr;
+    void enqueueCall(std::function<void()> call) {
+      std::lock_guard lock {m_queue_mutex};
+      m_queued_calls.push_back(std::move(call));
+      if (m_timer_service) {
+        m_timer_service->setDeadline(m_client_id, std::chrono::steady_clock::now());
+        return;
+      }
+
+      m_syncing_thread = true;
+      m_sleep_cv.notify_one();
     }
 
     /**
-     * @brief Manually wake up the thread for synchronization.
+     * @brief Get the time when the thread should wake up next (if ever).
+     * @note Both the interface and the queue mutexes must be locked.
+     */
+    std::optional<std::chrono::steady_clock::time_point> nextDeadlineUnlocked() {
+      if (!m_queued_calls.empty()) {
+        return std::chrono::steady_clock::now();
+      }
+
+      dropStaleDeadlinesUnlocked();
+      if (m_deadlines.empty()) {
+        return std::nullopt;
+      }
+      return m_deadlines.front().m_time;
+    }
+
+    /**
+     * @brief Add the next deadline of the task to the heap.
+     */
+    void pushDeadlineUnlocked(const std::string &name, Task &task) {
+      if (m_deadlines.size() > 2 * m_tasks.size() + 16) {
+        // Frequently replaced tasks with long sleep durations would otherwise pile up the stale deadlines
+        std::erase_if(m_deadlines, [this](const Deadline &deadline) {
+          const auto task_it {m_tasks.find(deadline.m_name)};
+          return task_it == std::end(m_tasks) || task_it->second.m_id != deadline.m_task_id;
+        });
+        std::ranges::make_heap(m_deadlines, std::greater {});
+      }
+
+      m_deadlines.push_back({std::chrono::steady_clock::now() + takeNextDuration(task.m_backoff_policy), task.m_id, name});
+      std::ranges::push_heap(m_deadlines, std::greater {});
+    }
+
+    /**
+     * @brief Remove the deadlines of the replaced or stopped tasks from the top of the heap.
+     */
+    void dropStaleDeadlinesUnlocked() {
+      while (!m_deadlines.empty()) {
+        const auto &deadline {m_deadlines.front()};
+        const auto task_it {m_tasks.find(deadline.m_name)};
+        if (task_it != std::end(m_tasks) && task_it->second.m_id == deadline.m_task_id) {
+          break;
+        }
+
+        std::ranges::pop_heap(m_deadlines, std::greater {});
+        m_deadlines.pop_back();
+      }
+    }
+
+    /**
+     * @brief Manually wake up the thread (or update the deadline in the timer service) for synchronization.
      */
     void syncThreadUnlocked() {
+      // The queue mutex is held while updating the deadline so that it cannot overwrite the one from `enqueueCall`
+      std::lock_guard lock {m_queue_mutex};
+      if (m_timer_service) {
+        m_timer_service->setDeadline(m_client_id, nextDeadlineUnlocked());
+        return;
+      }
+
       m_syncing_thread = true;
       m_sleep_cv.notify_one();
     }
 
     /**
-     * @brief Stop the scheduled function.
+     * @brief Stop the named task.
+     */
+    void stopTaskUnlocked(const std::string_view name) {
+      if (const auto task_it {m_tasks.find(name)}; task_it != std::end(m_tasks)) {
+        m_tasks.erase(task_it);
+        m_task_count.store(m_tasks.size(), std::memory_order_relaxed);
+        syncThreadUnlocked();
+      }
+    }
+
+    /**
+     * @brief Stop all of the scheduled functions.
      */
     void stopUnlocked() {
-      if (isScheduled()) {
-        clearThreadLoopUnlocked();
+      if (!m_tasks.empty()) {
+        m_tasks.clear();
+        m_deadlines.clear();
+        m_task_count.store(0, std::memory_order_relaxed);
         syncThreadUnlocked();
       }
     }
 
     std::unique_ptr<T> m_iface; /**< Interface to be passed around to the executor functions. */
-    std::vector<std::chrono::milliseconds> m_sleep_durations; /**< Sleep times for the timer. */
-    std::function<void(T &, SchedulerStopToken &)> m_retry_function {nullptr}; /**< Function to be executed until it succeeds. */
+    std::map<std::string, Task, std::less<>> m_tasks; /**< Scheduled tasks by their name. */
+    std::vector<Deadline> m_deadlines; /**< Min-heap of the task deadlines (may contain stale entries of the replaced tasks). */
+    std::uint64_t m_next_task_id {0}; /**< Id for the next scheduled task. */
+    std::atomic<std::size_t> m_task_count {0}; /**< Number of scheduled tasks for the lock-free `isScheduled` check. */
+    std::atomic<std::uint64_t> m_next_retry_id {0}; /**< Id for the name of the next unnamed `retryUntil` task. */
 
     mutable std::mutex m_mutex {}; /**< A mutex for synchronizing thread and "external" access. */
+    std::mutex m_queue_mutex {}; /**< A mutex for the queued calls and the thread wake-ups (never held while waiting for `m_mutex`). */
+    std::deque<std::function<void()>> m_queued_calls; /**< Calls to be executed by the thread before the tasks. */
     std::condition_variable m_sleep_cv {}; /**< Condition variable for waking up thread. */
     bool m_syncing_thread {false}; /**< Safeguard for the condition variable to prevent sporadic thread wake-ups. */
     bool m_keep_alive {true}; /**< When set to false, scheduler thread will exit. */
+    std::shared_ptr<SchedulerTimerService> m_timer_service; /**< Shared timer service that is used instead of the scheduler thread (if set). */
+    SchedulerTimerService::ClientId m_client_id {0}; /**< Id of this scheduler in the timer service. */
 
     // Always the last in the list so that all the members are already initialized!
     std::thread m_thread; /**< A scheduler thread. */
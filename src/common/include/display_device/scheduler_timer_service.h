@@ -0,0 +1,133 @@
+/**
+ * @file src/common/include/display_device/scheduler_timer_service.h
+ * @brief Declarations for the timer service shared between the RetrySchedulers.
+ */
+#pragma once
+
+// system includes
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace display_device {
+  /**
+   * @brief A single thread that serves the deadlines of multiple RetrySchedulers.
+   *
+   * Each registered client provides a callback that runs its due work and returns
+   * its next deadline. The callbacks of different clients are never executed
+   * concurrently, so a long running task delays the tasks of other clients.
+   *
+   * @examples
+   * const auto timer_service {std::make_shared<SchedulerTimerService>()};
+   * RetryScheduler<SettingsManagerInterface> scheduler_a {getIface(...), timer_service};
+   * RetryScheduler<SettingsManagerInterface> scheduler_b {getIface(...), timer_service};
+   * @examples_end
+   */
+  class SchedulerTimerService final {
+  public:
+    using Clock = std::chrono::steady_clock; /**< Clock for the deadlines. */
+    using ClientId = std::uint64_t; /**< Identifier of the registered client. */
+    using Callback = std::function<std::optional<Clock::time_point>()>; /**< Runs the due work and returns the next deadline (if any). */
+
+    /**
+     * @brief Default constructor. Starts the thread.
+     */
+    SchedulerTimerService();
+
+    /**
+     * @brief A destructor that gracefully shuts down the thread.
+     */
+    ~SchedulerTimerService();
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    SchedulerTimerService(const SchedulerTimerService &) = delete;
+
+    /**
+     * @brief Deleted copy operator.
+     */
+    SchedulerTimerService &operator=(const SchedulerTimerService &) = delete;
+
+    /**
+     * @brief Register a new client without a deadline.
+     * @param callback Callback to be invoked once the deadline is reached.
+     * @returns Identifier of the client.
+     */
+    [[nodiscard]] ClientId registerClient(Callback callback);
+
+    /**
+     * @brief Remove the client. Blocks until its callback is no longer running.
+     * @param id Identifier of the client.
+     * @warning Must not be called from within the callback.
+     */
+    void unregisterClient(ClientId id);
+
+    /**
+     * @brief Replace the deadline of the client.
+     * @param id Identifier of the client.
+     * @param deadline New deadline or an empty optional to not invoke the client at all.
+     */
+    void setDeadline(ClientId id, std::optional<Clock::time_point> deadline);
+
+  private:
+    /**
+     * @brief Registered client.
+     */
+    struct Client {
+      Callback m_callback; /**< Callback to be invoked. */
+      std::uint64_t m_generation {0}; /**< Incremented on every deadline change to detect the stale heap entries. */
+    };
+
+    /**
+     * @brief Deadline of the client.
+     */
+    struct Deadline {
+      Clock::time_point m_time; /**< When to invoke the client. */
+      ClientId m_client_id; /**< Id of the client. */
+      std::uint64_t m_generation; /**< Generation of the client when the deadline was added. */
+
+      /**
+       * @brief Comparator for the min-heap.
+       */
+      friend bool operator>(const Deadline &lhs, const Deadline &rhs) {
+        return lhs.m_time > rhs.m_time;
+      }
+    };
+
+    /**
+     * @brief Thread loop.
+     */
+    void run();
+
+    /**
+     * @brief Add the deadline and wake up the thread.
+     */
+    void setDeadlineUnlocked(ClientId id, Client &client, std::optional<Clock::time_point> deadline);
+
+    /**
+     * @brief Remove the deadlines of the removed clients or the replaced deadlines from the top of the heap.
+     */
+    void dropStaleDeadlinesUnlocked();
+
+    std::map<ClientId, Client> m_clients; /**< Registered clients. */
+    std::vector<Deadline> m_deadlines; /**< Min-heap of the client deadlines (may contain stale entries). */
+    ClientId m_next_client_id {0}; /**< Id for the next registered client. */
+    std::optional<ClientId> m_running_client_id; /**< Client whose callback is running right now. */
+
+    std::mutex m_mutex; /**< A mutex for synchronizing thread and "external" access. */
+    std::condition_variable m_sleep_cv; /**< Condition variable for waking up thread. */
+    std::condition_variable m_client_done_cv; /**< Condition variable for waiting until the client callback is done. */
+    bool m_syncing_thread {false}; /**< Safeguard for the condition variable to prevent sporadic thread wake-ups. */
+    bool m_keep_alive {true}; /**< When set to false, thread will exit. */
+
+    // Always the last in the list so that all the members are already initialized!
+    std::thread m_thread; /**< A timer thread. */
+  };
+}  // namespace display_device
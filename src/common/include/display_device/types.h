@@ -5,9 +5,13 @@
 #pragma once
 
 // system includes
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <optional>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -64,12 +68,93 @@ namespace display_device {
    */
   using FloatingPoint = std::variant<double, Rational>;
 
+  /**
+   * @brief A short string stored inline with a fixed maximum size.
+   *
+   * Unlike std::string it never allocates and is trivially copyable,
+   * which makes it suitable for short fixed-width fields.
+   */
+  template<std::size_t N>
+  class FixedString {
+    static_assert(N > 0 && N <= 0xFF, "FixedString size must fit into a single byte!");
+
+  public:
+    static constexpr std::size_t MAX_SIZE {N}; /**< Maximum number of characters. */
+
+    /**
+     * @brief Default constructor for an empty string.
+     */
+    constexpr FixedString() = default;
+
+    /**
+     * @brief Construct the string from a literal.
+     * @param value String literal that must fit into the string.
+     * @examples
+     * const FixedString<3> id { "ACI" };
+     * @examples_end
+     */
+    template<std::size_t M>
+      requires(M > 0 && M - 1 <= N)
+    constexpr FixedString(const char (&value)[M]):  // NOLINT(*-explicit-constructor)
+        FixedString(std::string_view {value, M - 1}) {}
+
+    /**
+     * @brief Construct the string from an arbitrary string.
+     * @param value String to copy. Throws if it does not fit.
+     */
+    explicit constexpr FixedString(const std::string_view value) {
+      if (value.size() > N) {
+        throw std::logic_error {"String is too long for FixedString!"};
+      }
+
+      std::ranges::copy(value, std::begin(m_data));
+      m_size = static_cast<std::uint8_t>(value.size());
+    }
+
+    /**
+     * @brief Get the string view of the contents.
+     * @returns View of the stored characters.
+     */
+    [[nodiscard]] constexpr std::string_view view() const {
+      return {m_data.data(), m_size};
+    }
+
+    /**
+     * @brief Get the number of stored characters.
+     * @returns Number of characters.
+     */
+    [[nodiscard]] constexpr std::size_t size() const {
+      return m_size;
+    }
+
+    /**
+     * @brief Check if the string is empty.
+     * @returns True if empty, false otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const {
+      return m_size == 0;
+    }
+
+    /**
+     * @brief Comparator for strict equality.
+     */
+    friend constexpr bool operator==(const FixedString &lhs, const FixedString &rhs) {
+      return lhs.view() == rhs.view();
+    }
+
+  private:
+    std::array<char, N> m_data {};
+    std::uint8_t m_size {};
+  };
+
+  class EdidView;
+
   /**
    * @brief Parsed EDID data.
    */
   struct EdidData {
-    std::string m_manufacturer_id {};
-    std::string m_product_code {};
+    FixedString<3> m_manufacturer_id {};
+    FixedString<4> m_product_code {};
     std::uint32_t m_serial_number {};
 
     /**
@@ -79,6 +164,13 @@ namespace display_device {
      */
     static std::optional<EdidData> parse(const std::vector<std::byte> &data);
 
+    /**
+     * @brief Parse EDID data from the view with an already validated base block.
+     * @param view View to parse the data from.
+     * @return Parsed data or empty optional if failed to parse it.
+     */
+    static std::optional<EdidData> fromView(const EdidView &view);
+
     /**
      * @brief Comparator for strict equality.
      */
@@ -0,0 +1,176 @@
+/**
+ * @file src/common/log_record.cpp
+ * @brief Definitions for the structured log record.
+ */
+// class header include
+#include "display_device/log_record.h"
+
+// system includes
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <span>
+
+namespace display_device {
+  namespace {
+    enum Tag : std::uint8_t {
+      TAG_BOOL,
+      TAG_INT,
+      TAG_UINT,
+      TAG_DOUBLE,
+      TAG_STRING
+    };
+
+    template<class T>
+    void appendBytes(std::vector<std::byte> &data, const T &value) {
+      const auto bytes {std::as_bytes(std::span {&value, 1})};
+      data.insert(std::end(data), std::begin(bytes), std::end(bytes));
+    }
+
+    template<class T>
+    T readBytes(const std::vector<std::byte> &data, std::size_t &offset) {
+      T value;
+      std::memcpy(&value, data.data() + offset, sizeof(T));
+      offset += sizeof(T);
+      return value;
+    }
+
+    std::string_view readString(const std::vector<std::byte> &data, std::size_t &offset, const std::size_t size) {
+      const std::string_view value {reinterpret_cast<const char *>(data.data() + offset), size};
+      offset += size;
+      return value;
+    }
+
+    template<class T>
+    void appendNumber(std::string &output, const T value) {
+      std::array<char, 32> buffer {};
+      const auto result {[&]() {
+        if constexpr (std::is_floating_point_v<T>) {
+          // Same as the default std::ostream formatting
+          return std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::general, 6);
+        } else {
+          return std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        }
+      }()};
+      output.append(buffer.data(), result.ptr);
+    }
+  }  // namespace
+
+  std::vector<LogRecord::Field> LogRecord::getFields() const {
+    std::vector<Field> fields;
+    std::size_t offset {0};
+    while (offset < m_data.size()) {
+      const auto tag {readBytes<std::uint8_t>(m_data, offset)};
+      const auto name_size {readBytes<std::uint8_t>(m_data, offset)};
+      const auto name {readString(m_data, offset, name_size)};
+
+      switch (tag) {
+        case TAG_BOOL:
+          fields.push_back({name, readBytes<bool>(m_data, offset)});
+          break;
+        case TAG_INT:
+          fields.push_back({name, readBytes<std::int64_t>(m_data, offset)});
+          break;
+        case TAG_UINT:
+          fields.push_back({name, readBytes<std::uint64_t>(m_data, offset)});
+          break;
+        case TAG_DOUBLE:
+          fields.push_back({name, readBytes<double>(m_data, offset)});
+          break;
+        case TAG_STRING:
+        default:
+          {
+            const auto size {readBytes<std::uint32_t>(m_data, offset)};
+            fields.push_back({name, readString(m_data, offset, size)});
+            break;
+          }
+      }
+    }
+    return fields;
+  }
+
+  std::string LogRecord::format() const {
+    std::string output;
+    const auto append_value {[&output](const auto &value) {
+      using Type = std::decay_t<decltype(value)>;
+      if constexpr (std::is_same_v<Type, bool>) {
+        output.append(1, value ? '1' : '0');  // Same as the default std::ostream formatting
+      } else if constexpr (std::is_same_v<Type, std::string_view>) {
+        output.append(value);
+      } else {
+        appendNumber(output, value);
+      }
+    }};
+
+    for (const auto &field : getFields()) {
+      if (!field.m_name.empty()) {
+        output.append(field.m_name).append(1, '=');
+      }
+      std::visit(append_value, field.m_value);
+    }
+    return output;
+  }
+
+  bool LogRecord::empty() const {
+    return m_data.empty();
+  }
+
+  std::span<const std::byte> LogRecord::getEncoded() const {
+    return m_data;
+  }
+
+  LogRecord LogRecord::fromEncoded(const std::span<const std::byte> data) {
+    LogRecord record;
+    record.m_data.assign(std::begin(data), std::end(data));
+    return record;
+  }
+
+  bool operator==(const LogRecord &lhs, const LogRecord &rhs) {
+    return lhs.m_data == rhs.m_data;
+  }
+
+  void LogRecord::appendBool(const std::string_view name, const bool value) {
+    appendHeader(TAG_BOOL, name);
+    appendBytes(m_data, value);
+  }
+
+  void LogRecord::appendInt(const std::string_view name, const std::int64_t value) {
+    appendHeader(TAG_INT, name);
+    appendBytes(m_data, value);
+  }
+
+  void LogRecord::appendUInt(const std::string_view name, const std::uint64_t value) {
+    appendHeader(TAG_UINT, name);
+    appendBytes(m_data, value);
+  }
+
+  void LogRecord::appendDouble(const std::string_view name, const double value) {
+    appendHeader(TAG_DOUBLE, name);
+    appendBytes(m_data, value);
+  }
+
+  void LogRecord::appendString(const std::string_view name, const std::string_view value) {
+    const auto size {static_cast<std::uint32_t>(std::min<std::size_t>(value.size(), std::numeric_limits<std::uint32_t>::max()))};
+    appendHeader(TAG_STRING, name);
+    appendBytes(m_data, size);
+
+    const auto bytes {std::as_bytes(std::span {value.data(), size})};
+    m_data.insert(std::end(m_data), std::begin(bytes), std::end(bytes));
+  }
+
+  void LogRecord::appendHeader(const std::uint8_t tag, const std::string_view name) {
+    // Names are meant to be short identifiers, longer ones are truncated
+    const auto name_size {static_cast<std::uint8_t>(std::min<std::size_t>(name.size(), std::numeric_limits<std::uint8_t>::max()))};
+    if (m_data.empty()) {
+      m_data.reserve(64);
+    }
+
+    m_data.push_back(static_cast<std::byte>(tag));
+    m_data.push_back(static_cast<std::byte>(name_size));
+
+    const auto bytes {std::as_bytes(std::span {name.data(), name_size})};
+    m_data.insert(std::end(m_data), std::begin(bytes), std::end(bytes));
+  }
+}  // namespace display_device
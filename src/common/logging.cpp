@@ -2,120 +2,914 @@
  * @file src/common/logging.cpp
  * @brief Definitions for the logging utility.
  */
-#if !defined(_MSC_VER) && !defined(_POSIX_THREAD_SAFE_FUNCTIONS)
-  #define _POSIX_THREAD_SAFE_FUNCTIONS  // For localtime_r
-#endif
-
 // class header include
 #include "display_device/logging.h"
 
 // system includes
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <chrono>
-#include <iomanip>
+#include <cstring>
 #include <iostream>
 #include <mutex>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// local includes
+#include "display_device/detail/mpsc_ring_buffer.h"
+#include "display_device/detail/timestamp_formatter.h"
 
 namespace display_device {
+  namespace detail {
+    /**
+     * @brief Callbacks and sinks of the log outputs.
+     */
+    struct LogSinkRegistry {
+      /**
+       * @brief Additional sink with its own log level.
+       */
+      struct Sink {
+        Logger::SinkId m_id;
+        Logger::LogLevel m_log_level;
+        Logger::Callback m_callback;
+      };
+
+      Logger::Callback m_custom_callback;
+      Logger::RecordCallback m_record_callback;
+      std::vector<Sink> m_sinks;
+    };
+
+    std::string_view getLogLevelPrefix(const Logger::LogLevel log_level) {
+      switch (log_level) {  // GCOVR_EXCL_BR_LINE for when there is no case match...
+        case Logger::LogLevel::verbose:
+          return "VERBOSE: ";
+        case Logger::LogLevel::debug:
+          return "DEBUG:   ";
+        case Logger::LogLevel::info:
+          return "INFO:    ";
+        case Logger::LogLevel::warning:
+          return "WARNING: ";
+        case Logger::LogLevel::error:
+          return "ERROR:   ";
+        case Logger::LogLevel::fatal:
+          return "FATAL:   ";
+      }
+      return {};  // GCOVR_EXCL_LINE
+    }
+  }  // namespace detail
+
   namespace {
-    std::tm threadSafeLocaltime(const std::time_t &time) {
-#if defined(_MSC_VER)  // MSVCRT (2005+): std::localtime is threadsafe
-      const auto tm_ptr {std::localtime(&time)};
-#else  // POSIX
-      std::tm buffer;
-      const auto tm_ptr {localtime_r(&time, &buffer)};
-#endif  // _MSC_VER
-      if (tm_ptr) {
-        return *tm_ptr;
-      }
-      return {};
+    /**
+     * @brief Set for the background thread of the asynchronous mode.
+     */
+    thread_local bool t_is_async_writer {false};
+
+    /**
+     * @brief Set while the deduplicator is writing out the message (to detect the logging from within the callback).
+     */
+    thread_local bool t_is_deduplicating {false};
+
+    /**
+     * @brief Last records of a single thread for the flight recorder.
+     *
+     * Only the owning thread writes to the ring and it does so without locking. The text (or the
+     * encoded record) is copied into the arena, which is used as a ring as well, so a long record
+     * evicts more of the older ones instead of being cut. The reader copies the entries and then
+     * drops the ones that were overwritten in the meantime (seqlock), so the entries and the arena
+     * are stored as relaxed atomic words.
+     */
+    struct FlightRecorderRing {
+      /**
+       * @brief Record in the binary form, its data is stored in the arena.
+       */
+      struct Entry {
+        std::chrono::system_clock::time_point m_time;
+        std::thread::id m_thread_id;
+        Logger::LogLevel m_log_level;
+        bool m_is_record;  // The data is the encoded LogRecord instead of the text
+        std::uint64_t m_offset;  // Position of the data in the arena (in bytes), not wrapped
+        std::size_t m_size;
+        std::size_t m_cut_size;  // Length of the text that did not fit into the arena
+      };
+      static_assert(std::is_trivially_copyable_v<Entry>);
+
+      using Word = std::atomic<std::uint64_t>;
+      static constexpr std::size_t WORD_SIZE {sizeof(std::uint64_t)};
+      static constexpr std::size_t ENTRY_WORDS {(sizeof(Entry) + WORD_SIZE - 1) / WORD_SIZE};
+
+      static std::size_t getWordCount(const std::size_t size) {
+        return (size + WORD_SIZE - 1) / WORD_SIZE;
+      }
+
+      static void storeWords(Word *words, const std::span<const std::byte> data) {
+        for (std::size_t offset {0}; offset < data.size(); offset += WORD_SIZE) {
+          std::uint64_t word {0};
+          std::memcpy(&word, data.data() + offset, std::min(WORD_SIZE, data.size() - offset));
+          (words++)->store(word, std::memory_order_relaxed);
+        }
+      }
+
+      static void loadWords(const Word *words, const std::span<std::byte> data) {
+        for (std::size_t offset {0}; offset < data.size(); offset += WORD_SIZE) {
+          const std::uint64_t word {(words++)->load(std::memory_order_relaxed)};
+          std::memcpy(data.data() + offset, &word, std::min(WORD_SIZE, data.size() - offset));
+        }
+      }
+
+      void storeEntry(const std::uint64_t index, const Entry &entry) {
+        storeWords(m_entries.data() + (index % getCapacity()) * ENTRY_WORDS, std::as_bytes(std::span {&entry, 1}));
+      }
+
+      [[nodiscard]] Entry loadEntry(const std::uint64_t index) const {
+        Entry entry {};
+        loadWords(m_entries.data() + (index % getCapacity()) * ENTRY_WORDS, std::as_writable_bytes(std::span {&entry, 1}));
+        return entry;
+      }
+
+      [[nodiscard]] std::size_t getCapacity() const {
+        return m_entries.size() / ENTRY_WORDS;
+      }
+
+      [[nodiscard]] std::size_t getArenaSize() const {
+        return m_arena.size() * WORD_SIZE;
+      }
+
+      std::mutex m_mutex;  // Only taken while dumping and while the owning thread (re)allocates the ring
+      std::uint64_t m_generation {0};  // Flight recorder generation the entries belong to
+      std::vector<Word> m_entries;  // ENTRY_WORDS per entry
+      std::vector<Word> m_arena;
+      std::atomic<std::uint64_t> m_arena_end {0};  // End of the data being written (in bytes), not wrapped
+      std::atomic<std::uint64_t> m_started_count {0};  // Number of the entries being or already written
+      std::atomic<std::uint64_t> m_published_count {0};  // Number of the fully written entries
+      std::atomic<bool> m_in_use {false};
+    };
+
+    /**
+     * @brief Ring of the current thread that is released for the reuse once the thread exits.
+     * @note The ring is co-owned, so that the threads exiting after the logger is destroyed do not touch freed memory.
+     */
+    struct FlightRecorderRingHandle {
+      ~FlightRecorderRingHandle() {
+        if (m_ring) {
+          m_ring->m_in_use.store(false, std::memory_order_release);
+        }
+      }
+
+      std::shared_ptr<FlightRecorderRing> m_ring;
+    };
+
+    thread_local FlightRecorderRingHandle t_flight_recorder_ring;
+
+    /**
+     * @brief Write the line with the timestamp and the level prefix to the standard output.
+     */
+    void writeToStdout(const Logger::LogLevel log_level, const std::string_view value, const std::chrono::system_clock::time_point now) {
+      detail::TimestampBuffer timestamp_buffer;
+      const auto timestamp {detail::formatTimestamp(now, timestamp_buffer)};
+      const auto level_prefix {detail::getLogLevelPrefix(log_level)};
+
+      static std::mutex log_mutex;
+      std::lock_guard lock {log_mutex};
+      std::cout << timestamp << level_prefix << value << std::endl;
+    }
+
+    /**
+     * @brief Text or the structured record that is yet to be formatted.
+     */
+    using Payload = std::variant<std::string, LogRecord>;
+
+    /**
+     * @brief Write the payload to the sinks and the custom callback(s) or to the standard output.
+     */
+    void writeRecord(const detail::LogSinkRegistry &sinks, const Logger::LogLevel log_level, Payload payload, const std::chrono::system_clock::time_point now) {
+      std::optional<std::string> formatted;
+      const auto get_text {[&payload, &formatted]() -> const std::string & {
+        if (const auto *text {std::get_if<std::string>(&payload)}) {
+          return *text;
+        }
+        if (!formatted) {
+          formatted = std::get<LogRecord>(payload).format();
+        }
+        return *formatted;
+      }};
+
+      for (const auto &sink : sinks.m_sinks) {
+        if (log_level >= sink.m_log_level) {
+          sink.m_callback(log_level, get_text());
+        }
+      }
+
+      if (const auto &record_callback {sinks.m_record_callback}) {
+        if (auto *text {std::get_if<std::string>(&payload)}) {
+          LogRecord record;
+          record.append({}, *text);
+          record_callback(log_level, record);
+        } else {
+          record_callback(log_level, std::get<LogRecord>(payload));
+        }
+      }
+
+      const auto &callback {sinks.m_custom_callback};
+      if (!callback && sinks.m_record_callback) {
+        // The record callback replaces the standard output, same as the custom callback does
+        return;
+      }
+
+      std::string value;
+      if (auto *text {std::get_if<std::string>(&payload)}) {
+        value = std::move(*text);
+      } else if (formatted) {
+        value = std::move(*formatted);
+      } else {
+        value = std::get<LogRecord>(payload).format();
+      }
+
+      if (callback) {
+        callback(log_level, std::move(value));
+        return;
+      }
+
+      writeToStdout(log_level, value, now);
     }
   }  // namespace
 
+  /**
+   * @brief Snapshot of everything the writers need besides the log levels.
+   *
+   * Never modified after being published and only destroyed once no writer uses it,
+   * so the writers load it once per write without any locks.
+   */
+  struct Logger::Config {
+    detail::LogSinkRegistry m_sinks;
+    std::shared_ptr<AsyncBackend> m_async_backend;  // Background writer if the asynchronous mode is enabled
+    std::shared_ptr<Deduplicator> m_deduplicator;  // State for the deduplication if it is enabled
+  };
+
+  /**
+   * @brief Background writer for the asynchronous mode.
+   *
+   * Producers push the records to the lock-free ring buffer and only wake up the
+   * writer thread, which then does the formatting and writes to the output.
+   */
+  class Logger::AsyncBackend {
+  public:
+    AsyncBackend(const AsyncOptions &options, const detail::RcuPtr<Config> &config):
+        m_options {options},
+        m_config {config},
+        m_buffer {std::bit_ceil(std::max<std::size_t>(options.m_capacity, 2))},
+        m_thread {[this]() {
+          run();
+        }} {
+    }
+
+    ~AsyncBackend() {
+      m_stop_requested.store(true, std::memory_order_release);
+      m_signal.fetch_add(1, std::memory_order_release);
+      m_signal.notify_one();
+      m_thread.join();
+    }
+
+    void push(const detail::LogSinkRegistry &sinks, const LogLevel log_level, Payload payload) {
+      const auto now {std::chrono::system_clock::now()};
+      if (t_is_async_writer) {
+        // Logging from within the custom callback - waiting for ourselves would be a deadlock
+        writeRecord(sinks, log_level, std::move(payload), now);
+        return;
+      }
+
+      Record record {log_level, std::move(payload), now};
+      while (!m_buffer.tryPush(record)) {
+        if (m_options.m_overflow_policy != OverflowPolicy::Block) {
+          m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+          if (m_options.m_overflow_policy == OverflowPolicy::Count) {
+            m_unreported_dropped_count.fetch_add(1, std::memory_order_relaxed);
+          }
+          return;
+        }
+
+        const auto written_count {m_written_count.load(std::memory_order_acquire)};
+        if (m_buffer.tryPush(record)) {
+          break;
+        }
+        m_written_count.wait(written_count, std::memory_order_acquire);
+      }
+
+      m_signal.fetch_add(1, std::memory_order_release);
+      m_signal.notify_one();
+    }
+
+    void flush() {
+      if (t_is_async_writer) {
+        return;
+      }
+
+      // Records are popped in the same order they were enqueued, so it's enough to wait for the counter to catch up
+      const auto target_count {m_buffer.getEnqueuedCount()};
+      auto written_count {m_written_count.load(std::memory_order_acquire)};
+      while (written_count < target_count) {
+        m_written_count.wait(written_count, std::memory_order_acquire);
+        written_count = m_written_count.load(std::memory_order_acquire);
+      }
+    }
+
+    [[nodiscard]] std::uint64_t getDroppedCount() const {
+      return m_dropped_count.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct Record {
+      LogLevel m_log_level {};
+      Payload m_payload;
+      std::chrono::system_clock::time_point m_time;
+    };
+
+    void run() {
+      t_is_async_writer = true;
+
+      Record record;
+      while (true) {
+        const auto signal {m_signal.load(std::memory_order_acquire)};
+        while (m_buffer.tryPop(record)) {
+          writeRecord(m_config.read()->m_sinks, record.m_log_level, std::move(record.m_payload), record.m_time);
+          m_written_count.fetch_add(1, std::memory_order_release);
+          m_written_count.notify_all();
+          reportDroppedRecords();
+        }
+        reportDroppedRecords();
+
+        if (m_stop_requested.load(std::memory_order_acquire)) {
+          if (m_buffer.getEnqueuedCount() == m_written_count.load(std::memory_order_acquire)) {
+            break;
+          }
+
+          // Some producer is still in the middle of pushing the record
+          std::this_thread::yield();
+          continue;
+        }
+
+        m_signal.wait(signal, std::memory_order_acquire);
+      }
+    }
+
+    void reportDroppedRecords() {
+      if (const auto count {m_unreported_dropped_count.exchange(0, std::memory_order_relaxed)}; count > 0) {
+        writeRecord(m_config.read()->m_sinks, LogLevel::warning, "Dropped " + std::to_string(count) + " log record(s) due to the full queue!", std::chrono::system_clock::now());
+      }
+    }
+
+    AsyncOptions m_options;
+    const detail::RcuPtr<Config> &m_config;  // Loaded per record, so the sinks can be changed without a restart
+    detail::MpscRingBuffer<Record> m_buffer;
+    std::atomic<std::size_t> m_written_count {0};
+    std::atomic<std::uint32_t> m_signal {0};
+    std::atomic<bool> m_stop_requested {false};
+    std::atomic<std::uint64_t> m_dropped_count {0};
+    std::atomic<std::uint64_t> m_unreported_dropped_count {0};
+    std::thread m_thread;  // Must be the last member so that the thread starts with everything else initialized
+  };
+
+  /**
+   * @brief Collapses the identical consecutive messages into a summary.
+   *
+   * The lock only guards the last message, so that the output of different threads is not
+   * serialized. The summary is written right before the message that ended the repeats, but
+   * the messages of other threads may be written in between.
+   */
+  class Logger::Deduplicator {
+  public:
+    void process(Logger &logger, const Config &config, const LogLevel log_level, Payload payload) {
+      if (t_is_deduplicating) {
+        // Logging from within the custom callback - skip the deduplication to avoid the recursion
+        logger.dispatch(config, log_level, std::move(payload));
+        return;
+      }
+
+      // Only the comparison is done under the lock, the output happens after releasing it
+      std::optional<Repeats> repeats;
+      {
+        std::lock_guard lock {m_mutex};
+        if (m_last_message && m_last_message->first == log_level && m_last_message->second == payload) {
+          ++m_repeat_count;
+          return;
+        }
+
+        repeats = takeRepeatsUnlocked();
+        if (m_last_message) {
+          // Assigning the same alternative reuses the already allocated buffer
+          m_last_message->first = log_level;
+          m_last_message->second = payload;
+        } else {
+          m_last_message.emplace(log_level, payload);
+        }
+      }
+
+      DeduplicatingScope scope;
+      reportRepeats(logger, config, repeats);
+      logger.dispatch(config, log_level, std::move(payload));
+    }
+
+    void flush(Logger &logger, const Config &config) {
+      std::optional<Repeats> repeats;
+      {
+        std::lock_guard lock {m_mutex};
+        repeats = takeRepeatsUnlocked();
+      }
+
+      DeduplicatingScope scope;
+      reportRepeats(logger, config, repeats);
+    }
+
+  private:
+    /**
+     * @brief Number of the repeats of the last message with its log level.
+     */
+    using Repeats = std::pair<LogLevel, std::uint64_t>;
+
+    /**
+     * @brief Sets the t_is_deduplicating for the scope.
+     */
+    struct DeduplicatingScope {
+      DeduplicatingScope() {
+        t_is_deduplicating = true;
+      }
+
+      ~DeduplicatingScope() {
+        t_is_deduplicating = false;
+      }
+    };
+
+    std::optional<Repeats> takeRepeatsUnlocked() {
+      if (m_repeat_count == 0) {
+        return std::nullopt;
+      }
+      return Repeats {m_last_message->first, std::exchange(m_repeat_count, 0)};
+    }
+
+    static void reportRepeats(Logger &logger, const Config &config, const std::optional<Repeats> &repeats) {
+      if (repeats) {
+        logger.dispatch(config, repeats->first, "Last message repeated " + std::to_string(repeats->second) + " time(s).");
+      }
+    }
+
+    std::mutex m_mutex;
+    std::optional<std::pair<LogLevel, Payload>> m_last_message;
+    std::uint64_t m_repeat_count {0};
+  };
+
+  /**
+   * @brief Keeps the last records of every thread in memory and formats them on demand.
+   *
+   * Each thread writes to its own ring, so capturing only costs the copy of the data and
+   * a few atomic stores. The rings of the exited threads (together with their records)
+   * are kept and reused by the new threads.
+   */
+  class Logger::FlightRecorder {
+  public:
+    void reset(const std::size_t capacity) {
+      // The rings are reallocated by their threads on the next capture
+      std::lock_guard lock {m_rings_mutex};
+      m_capacity.store(capacity, std::memory_order_relaxed);
+      m_generation.fetch_add(1, std::memory_order_release);
+    }
+
+    void capture(const LogLevel log_level, const std::string_view value) {
+      captureEntry(log_level, false, std::as_bytes(std::span {value}));
+    }
+
+    void capture(const LogLevel log_level, const LogRecord &record) {
+      const auto data {record.getEncoded()};
+      if (data.size() > m_capacity.load(std::memory_order_relaxed) * FLIGHT_RECORDER_BYTES_PER_RECORD) {
+        // Cannot be decoded if cut, so the text is captured instead
+        capture(log_level, record.format());
+        return;
+      }
+
+      captureEntry(log_level, true, data);
+    }
+
+    [[nodiscard]] std::string dump() const {
+      struct DumpedEntry {
+        FlightRecorderRing::Entry m_entry;
+        std::vector<std::byte> m_data;
+      };
+
+      std::vector<DumpedEntry> entries;
+      {
+        const auto generation {m_generation.load(std::memory_order_acquire)};
+        std::vector<DumpedEntry> ring_entries;
+
+        std::lock_guard lock {m_rings_mutex};
+        for (const auto &ring : m_rings) {
+          std::lock_guard ring_lock {ring->m_mutex};
+          if (ring->m_generation != generation || ring->m_entries.empty()) {
+            continue;
+          }
+
+          // The owning thread may be writing at the same time, so the entries and the
+          // data are copied first and only the ones that were not overwritten are kept
+          const auto count {ring->m_published_count.load(std::memory_order_acquire)};
+          const auto capacity {ring->getCapacity()};
+          const auto arena_size {ring->getArenaSize()};
+          const auto first_index {count - std::min<std::uint64_t>(count, capacity)};
+          ring_entries.clear();
+          for (auto i {first_index}; i < count; ++i) {
+            auto entry {ring->loadEntry(i)};
+            entry.m_size = std::min<std::size_t>(entry.m_size, arena_size - entry.m_offset % arena_size);
+
+            std::vector<std::byte> data(entry.m_size);
+            FlightRecorderRing::loadWords(ring->m_arena.data() + (entry.m_offset % arena_size) / FlightRecorderRing::WORD_SIZE, data);
+            ring_entries.push_back({entry, std::move(data)});
+          }
+
+          std::atomic_thread_fence(std::memory_order_acquire);
+          const auto started_count {ring->m_started_count.load(std::memory_order_relaxed)};
+          const auto arena_end {ring->m_arena_end.load(std::memory_order_relaxed)};
+          for (std::size_t i {0}; i < ring_entries.size(); ++i) {
+            if (first_index + i + capacity >= started_count && arena_end <= ring_entries[i].m_entry.m_offset + arena_size) {
+              entries.push_back(std::move(ring_entries[i]));
+            }
+          }
+        }
+      }
+
+      std::ranges::stable_sort(entries, std::less {}, [](const auto &entry) {
+        return entry.m_entry.m_time;
+      });
+
+      std::ostringstream output;
+      detail::TimestampBuffer timestamp_buffer;
+      for (const auto &[entry, data] : entries) {
+        output << detail::formatTimestamp(entry.m_time, timestamp_buffer) << detail::getLogLevelPrefix(entry.m_log_level) << "[" << entry.m_thread_id << "] ";
+        if (entry.m_is_record) {
+          output << LogRecord::fromEncoded(data).format();
+        } else {
+          output << std::string_view {reinterpret_cast<const char *>(data.data()), data.size()};
+        }
+
+        if (entry.m_cut_size > 0) {
+          output << "... (" << entry.m_cut_size << " more characters cut)";
+        }
+        output << "\n";
+      }
+      return output.str();
+    }
+
+  private:
+    void captureEntry(const LogLevel log_level, const bool is_record, std::span<const std::byte> data) {
+      auto &ring {getThreadRing()};
+      if (const auto generation {m_generation.load(std::memory_order_acquire)}; ring.m_generation != generation) {
+        resetRing(ring, generation);
+      }
+      if (ring.m_entries.empty()) {
+        return;
+      }
+
+      const auto arena_size {ring.getArenaSize()};
+      const auto cut_size {data.size() - std::min(data.size(), arena_size)};
+      if (is_record && cut_size > 0) {
+        // Cannot be decoded if cut (only possible while the capacity is being changed)
+        return;
+      }
+      data = data.first(data.size() - cut_size);
+
+      // The data is kept contiguous and word aligned, so the rest of the arena is skipped if it does not fit
+      const auto size {FlightRecorderRing::getWordCount(data.size()) * FlightRecorderRing::WORD_SIZE};
+      auto offset {ring.m_arena_end.load(std::memory_order_relaxed)};
+      if (offset % arena_size + size > arena_size) {
+        offset += arena_size - offset % arena_size;
+      }
+
+      // The overwritten entry and part of the arena must be visible before the data is touched
+      const auto index {ring.m_published_count.load(std::memory_order_relaxed)};
+      ring.m_started_count.store(index + 1, std::memory_order_relaxed);
+      ring.m_arena_end.store(offset + size, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+
+      FlightRecorderRing::storeWords(ring.m_arena.data() + (offset % arena_size) / FlightRecorderRing::WORD_SIZE, data);
+      ring.storeEntry(index, {std::chrono::system_clock::now(), std::this_thread::get_id(), log_level, is_record, offset, data.size(), cut_size});
+      ring.m_published_count.store(index + 1, std::memory_order_release);
+    }
+
+    void resetRing(FlightRecorderRing &ring, const std::uint64_t generation) const {
+      const auto capacity {m_capacity.load(std::memory_order_relaxed)};
+
+      std::lock_guard lock {ring.m_mutex};
+      ring.m_entries = std::vector<FlightRecorderRing::Word>(capacity * FlightRecorderRing::ENTRY_WORDS);
+      ring.m_arena = std::vector<FlightRecorderRing::Word>(capacity * FlightRecorderRing::getWordCount(FLIGHT_RECORDER_BYTES_PER_RECORD));
+      ring.m_arena_end.store(0, std::memory_order_relaxed);
+      ring.m_started_count.store(0, std::memory_order_relaxed);
+      ring.m_published_count.store(0, std::memory_order_relaxed);
+      ring.m_generation = generation;
+    }
+
+    FlightRecorderRing &getThreadRing() {
+      if (!t_flight_recorder_ring.m_ring) {
+        std::lock_guard lock {m_rings_mutex};
+        const auto it {std::ranges::find_if(m_rings, [](const auto &ring) {
+          return !ring->m_in_use.exchange(true, std::memory_order_acquire);
+        })};
+        if (it != std::end(m_rings)) {
+          t_flight_recorder_ring.m_ring = *it;
+        } else {
+          m_rings.push_back(std::make_shared<FlightRecorderRing>());
+          m_rings.back()->m_in_use.store(true, std::memory_order_relaxed);
+          t_flight_recorder_ring.m_ring = m_rings.back();
+        }
+      }
+      return *t_flight_recorder_ring.m_ring;
+    }
+
+    mutable std::mutex m_rings_mutex;
+    std::vector<std::shared_ptr<FlightRecorderRing>> m_rings;
+    std::atomic<std::size_t> m_capacity {0};
+    std::atomic<std::uint64_t> m_generation {0};  // Incremented on every reset to discard the captured records
+  };
+
   Logger &Logger::get() {
     static Logger instance;  // GCOVR_EXCL_BR_LINE for some reason...
     return instance;
   }
 
   void Logger::setLogLevel(const LogLevel log_level) {
-    m_enabled_log_level = log_level;
+    std::lock_guard lock {m_levels_mutex};
+    for (auto &category_log_level : m_log_levels) {
+      category_log_level.store(log_level, std::memory_order_relaxed);
+    }
+    updateCapturedLevelsUnlocked();
   }
 
-  bool Logger::isLogLevelEnabled(LogLevel log_level) const {
-    const auto log_level_v {static_cast<std::underlying_type_t<LogLevel>>(log_level)};
-    const auto enabled_log_level_v {static_cast<std::underlying_type_t<LogLevel>>(m_enabled_log_level)};
-    return log_level_v >= enabled_log_level_v;
+  void Logger::setLogLevel(const LogCategory category, const LogLevel log_level) {
+    std::lock_guard lock {m_levels_mutex};
+    m_log_levels[static_cast<std::size_t>(category)].store(log_level, std::memory_order_relaxed);
+    updateCapturedLevelsUnlocked();
+  }
+
+  Logger::LogLevel Logger::getLogLevel(const LogCategory category) const {
+    return m_log_levels[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
   }
 
   void Logger::setCustomCallback(Callback callback) {
-    m_custom_callback = std::move(callback);
+    updateConfig([&callback](Config &config) {
+      config.m_sinks.m_custom_callback = std::move(callback);
+    });
+  }
+
+  void Logger::setRecordCallback(RecordCallback callback) {
+    updateConfig([&callback](Config &config) {
+      config.m_sinks.m_record_callback = std::move(callback);
+    });
+  }
+
+  Logger::SinkId Logger::addSink(const LogLevel log_level, Callback callback) {
+    if (!callback) {
+      throw std::logic_error {"Logger::addSink requires a callback!"};
+    }
+
+    SinkId id {};
+    updateConfig([this, &id, log_level, &callback](Config &config) {
+      id = m_next_sink_id++;
+      config.m_sinks.m_sinks.push_back({id, log_level, std::move(callback)});
+    });
+    return id;
+  }
+
+  bool Logger::setSinkLogLevel(const SinkId id, const LogLevel log_level) {
+    bool found {false};
+    updateConfig([id, log_level, &found](Config &config) {
+      const auto it {std::ranges::find(config.m_sinks.m_sinks, id, &detail::LogSinkRegistry::Sink::m_id)};
+      if (it != std::end(config.m_sinks.m_sinks)) {
+        it->m_log_level = log_level;
+        found = true;
+      }
+    });
+    return found;
+  }
+
+  bool Logger::removeSink(const SinkId id) {
+    bool found {false};
+    updateConfig([id, &found](Config &config) {
+      found = std::erase_if(config.m_sinks.m_sinks, [id](const auto &sink) {
+                return sink.m_id == id;
+              }) > 0;
+    });
+    return found;
+  }
+
+  void Logger::removeAllSinks() {
+    updateConfig([](Config &config) {
+      config.m_sinks.m_sinks.clear();
+    });
+  }
+
+  std::unique_ptr<const Logger::Config> Logger::updateConfig(const std::function<void(Config &)> &update) {
+    return m_config.update([&update](const Config &current) {
+      auto config {std::make_unique<Config>(current)};
+      update(*config);
+      return config;
+    });
+  }
+
+  void Logger::throwIfReadingConfig(const std::string_view function_name) {
+    if (detail::RcuPtr<Config>::isReadByCurrentThread()) {
+      // The previous configuration (with the backend or deduplicator) could not be destroyed while it's being used
+      throw std::logic_error {std::string {function_name} + " must not be called from within the callbacks or sinks!"};
+    }
+  }
+
+  void Logger::enableAsync(const AsyncOptions &options) {
+    throwIfReadingConfig("Logger::enableAsync");
+    std::lock_guard lock {m_config_mutex};
+    // The previous backend writes out its records (destroyed with the returned configuration) before the new one starts
+    updateConfig([](Config &config) {
+      config.m_async_backend = nullptr;
+    });
+    updateConfig([this, &options](Config &config) {
+      config.m_async_backend = std::make_shared<AsyncBackend>(options, m_config);
+    });
+  }
+
+  void Logger::disableAsync() {
+    throwIfReadingConfig("Logger::disableAsync");
+    std::lock_guard lock {m_config_mutex};
+    updateConfig([](Config &config) {
+      config.m_async_backend = nullptr;
+    });
+  }
+
+  bool Logger::isAsyncEnabled() const {
+    return m_config.read()->m_async_backend != nullptr;
+  }
+
+  void Logger::flush() {
+    const auto config {m_config.read()};
+    if (config->m_deduplicator) {
+      config->m_deduplicator->flush(*this, *config);
+    }
+
+    if (config->m_async_backend) {
+      config->m_async_backend->flush();
+    }
+  }
+
+  std::uint64_t Logger::getDroppedRecordCount() const {
+    const auto config {m_config.read()};
+    return config->m_async_backend ? config->m_async_backend->getDroppedCount() : 0;
+  }
+
+  void Logger::setDeduplicationEnabled(const bool enabled) {
+    throwIfReadingConfig("Logger::setDeduplicationEnabled");
+    std::lock_guard lock {m_config_mutex};
+    const auto previous {updateConfig([enabled](Config &config) {
+      config.m_deduplicator = enabled ? std::make_shared<Deduplicator>() : nullptr;
+    })};
+    if (previous->m_deduplicator) {
+      // No writer uses the previous configuration anymore, so none of the repeats are lost
+      previous->m_deduplicator->flush(*this, *m_config.read());
+    }
+  }
+
+  bool Logger::isDeduplicationEnabled() const {
+    return m_config.read()->m_deduplicator != nullptr;
+  }
+
+  void Logger::enableFlightRecorder(const std::size_t records_per_thread, const LogLevel log_level) {
+    std::lock_guard lock {m_levels_mutex};
+    m_flight_recorder->reset(records_per_thread);
+    m_flight_recorder_level.store(static_cast<int>(log_level), std::memory_order_relaxed);
+    updateCapturedLevelsUnlocked();
+  }
+
+  void Logger::disableFlightRecorder() {
+    std::lock_guard lock {m_levels_mutex};
+    m_flight_recorder_level.store(std::numeric_limits<int>::max(), std::memory_order_relaxed);
+    updateCapturedLevelsUnlocked();
+  }
+
+  bool Logger::isFlightRecorderEnabled() const {
+    return m_flight_recorder_level.load(std::memory_order_relaxed) != std::numeric_limits<int>::max();
+  }
+
+  std::string Logger::dumpFlightRecorder() const {
+    return m_flight_recorder->dump();
+  }
+
+  void Logger::updateCapturedLevelsUnlocked() {
+    const auto flight_recorder_level {m_flight_recorder_level.load(std::memory_order_relaxed)};
+    for (std::size_t i {0}; i < LOG_CATEGORY_COUNT; ++i) {
+      const auto log_level {m_log_levels[i].load(std::memory_order_relaxed)};
+      const auto captured_level {static_cast<int>(log_level) <= flight_recorder_level ? log_level : static_cast<LogLevel>(flight_recorder_level)};
+      m_captured_levels[i].store(captured_level, std::memory_order_relaxed);
+    }
   }
 
   void Logger::write(const LogLevel log_level, std::string value) {
-    if (!isLogLevelEnabled(log_level)) {
+    write(LogCategory::general, log_level, std::move(value));
+  }
+
+  void Logger::write(const LogCategory category, const LogLevel log_level, std::string value) {
+    captureFlightRecord(log_level, value);
+    if (!isLogLevelEnabled(category, log_level)) {
       return;
     }
 
-    if (m_custom_callback) {
-      m_custom_callback(log_level, std::move(value));
+    output(*m_config.read(), log_level, std::move(value));
+  }
+
+  void Logger::write(const LogLevel log_level, LogRecord record) {
+    write(LogCategory::general, log_level, std::move(record));
+  }
+
+  void Logger::write(const LogCategory category, const LogLevel log_level, LogRecord record) {
+    captureFlightRecord(log_level, record);
+    if (!isLogLevelEnabled(category, log_level)) {
       return;
     }
 
-    std::stringstream stream;
-    {
-      // Time (limited by GCC 10, so it's not pretty...)
-      {
-        const auto now {std::chrono::system_clock::now()};
-        const auto now_ms {std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch())};
-        const auto now_s {std::chrono::duration_cast<std::chrono::seconds>(now_ms)};
+    output(*m_config.read(), log_level, std::move(record));
+  }
 
-        const std::time_t time {std::chrono::system_clock::to_time_t(now)};
-        const auto localtime {threadSafeLocaltime(time)};
-        const auto now_decimal_part {now_ms - now_s};
+  void Logger::writeText(const LogCategory category, const LogLevel log_level, const std::string_view value) {
+    captureFlightRecord(log_level, value);
+    if (!isLogLevelEnabled(category, log_level)) {
+      return;
+    }
 
-        const auto old_flags {stream.flags()};  // Save formatting flags so that they can be restored...
-        stream << std::put_time(&localtime, "[%Y-%m-%d %H:%M:%S.") << std::setfill('0') << std::setw(3) << now_decimal_part.count() << "] ";
-        stream.flags(old_flags);
+    // The configuration is loaded only once and is kept for the whole write
+    const auto config {m_config.read()};
+    if (!config->m_deduplicator && !config->m_async_backend) {
+      const auto &sinks {config->m_sinks};
+      if (!sinks.m_custom_callback && !sinks.m_record_callback && sinks.m_sinks.empty()) {
+        writeToStdout(log_level, value, std::chrono::system_clock::now());
+        return;
       }
+    }
 
-      // Log level
-      switch (log_level) {  // GCOVR_EXCL_BR_LINE for when there is no case match...
-        case LogLevel::verbose:
-          stream << "VERBOSE: ";
-          break;
-        case LogLevel::debug:
-          stream << "DEBUG:   ";
-          break;
-        case LogLevel::info:
-          stream << "INFO:    ";
-          break;
-        case LogLevel::warning:
-          stream << "WARNING: ";
-          break;
-        case LogLevel::error:
-          stream << "ERROR:   ";
-          break;
-        case LogLevel::fatal:
-          stream << "FATAL:   ";
-          break;
-      }
+    output(*config, log_level, std::string {value});
+  }
+
+  void Logger::captureFlightRecord(const LogLevel log_level, const std::string_view value) {
+    if (static_cast<int>(log_level) >= m_flight_recorder_level.load(std::memory_order_relaxed)) {
+      m_flight_recorder->capture(log_level, value);
+    }
+  }
 
-      // Value
-      stream << value;
+  void Logger::captureFlightRecord(const LogLevel log_level, const LogRecord &record) {
+    if (static_cast<int>(log_level) >= m_flight_recorder_level.load(std::memory_order_relaxed)) {
+      m_flight_recorder->capture(log_level, record);
+    }
+  }
+
+  void Logger::output(const Config &config, const LogLevel log_level, Payload payload) {
+    if (config.m_deduplicator) {
+      config.m_deduplicator->process(*this, config, log_level, std::move(payload));
+      return;
+    }
+
+    dispatch(config, log_level, std::move(payload));
+  }
+
+  void Logger::dispatch(const Config &config, const LogLevel log_level, Payload payload) {
+    if (config.m_async_backend) {
+      config.m_async_backend->push(config.m_sinks, log_level, std::move(payload));
+      return;
     }
 
-    static std::mutex log_mutex;
-    std::lock_guard lock {log_mutex};
-    std::cout << stream.rdbuf() << std::endl;
+    writeRecord(config.m_sinks, log_level, std::move(payload), std::chrono::system_clock::now());
   }
 
   Logger::Logger():
-      m_enabled_log_level {LogLevel::info} {
+      m_config {std::make_unique<const Config>()},
+      m_flight_recorder {std::make_unique<FlightRecorder>()} {
+    setLogLevel(LogLevel::info);
+  }
+
+  Logger::~Logger() {
+    setDeduplicationEnabled(false);
+    disableAsync();
   }
 
-  LogWriter::LogWriter(const Logger::LogLevel log_level):
-      m_log_level {log_level} {}
+  LogWriter::LogWriter(const Logger::LogLevel log_level, const Logger::LogCategory category):
+      m_log_level {log_level},
+      m_category {category} {}
 
   LogWriter::~LogWriter() {
-    Logger::get().write(m_log_level, m_buffer.str());
+    Logger::get().writeText(m_category, m_log_level, m_buffer.view());
+  }
+
+  LogRecordWriter::LogRecordWriter(const Logger::LogLevel log_level, const Logger::LogCategory category):
+      m_log_level {log_level},
+      m_category {category} {}
+
+  LogRecordWriter::~LogRecordWriter() {
+    Logger::get().write(m_category, m_log_level, std::move(m_record));
   }
 }  // namespace display_device
@@ -0,0 +1,247 @@
+/**
+ * @file src/common/mapped_file_sink.cpp
+ * @brief Definitions for the memory-mapped rotating log file.
+ */
+// class header include
+#include "display_device/mapped_file_sink.h"
+
+// system includes
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+// local includes
+#include "display_device/detail/log_buffer.h"
+#include "display_device/detail/timestamp_formatter.h"
+
+namespace display_device {
+  namespace {
+    constexpr std::uint64_t GENERATION_SHIFT {40};
+    constexpr std::uint64_t OFFSET_MASK {(std::uint64_t {1} << GENERATION_SHIFT) - 1};
+
+    std::filesystem::path getBackupPath(const std::filesystem::path &filepath, const std::size_t index) {
+      auto backup_path {filepath};
+      backup_path += ".";
+      backup_path += std::to_string(index);
+      return backup_path;
+    }
+  }  // namespace
+
+  /**
+   * @brief Platform specific file mapping.
+   */
+  class MappedFileSink::MappedFile {
+  public:
+    static std::unique_ptr<MappedFile> create(const std::filesystem::path &filepath, const std::size_t size) {
+      auto file {std::unique_ptr<MappedFile>(new MappedFile {size})};
+#ifdef _WIN32
+      file->m_file = CreateFileW(filepath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file->m_file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+      }
+
+      const auto size_high {static_cast<DWORD>(static_cast<std::uint64_t>(size) >> 32)};
+      const auto size_low {static_cast<DWORD>(size & 0xFFFFFFFF)};
+      file->m_mapping = CreateFileMappingW(file->m_file, nullptr, PAGE_READWRITE, size_high, size_low, nullptr);
+      if (!file->m_mapping) {
+        return nullptr;
+      }
+
+      file->m_data = static_cast<char *>(MapViewOfFile(file->m_mapping, FILE_MAP_WRITE, 0, 0, size));
+      if (!file->m_data) {
+        return nullptr;
+      }
+#else
+      file->m_file = ::open(filepath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+      if (file->m_file < 0 || ::ftruncate(file->m_file, static_cast<off_t>(size)) != 0) {
+        return nullptr;
+      }
+
+      auto *data {::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file->m_file, 0)};
+      if (data == MAP_FAILED) {
+        return nullptr;
+      }
+      file->m_data = static_cast<char *>(data);
+#endif
+      return file;
+    }
+
+    ~MappedFile() {
+#ifdef _WIN32
+      if (m_data) {
+        UnmapViewOfFile(m_data);
+      }
+      if (m_mapping) {
+        CloseHandle(m_mapping);
+      }
+      if (m_file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER used_size;
+        used_size.QuadPart = static_cast<LONGLONG>(m_used_size);
+        if (SetFilePointerEx(m_file, used_size, nullptr, FILE_BEGIN)) {
+          SetEndOfFile(m_file);
+        }
+        CloseHandle(m_file);
+      }
+#else
+      if (m_data) {
+        ::munmap(m_data, m_size);
+      }
+      if (m_file >= 0) {
+        static_cast<void>(::ftruncate(m_file, static_cast<off_t>(m_used_size)));
+        ::close(m_file);
+      }
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    [[nodiscard]] char *getData() const {
+      return m_data;
+    }
+
+    void setUsedSize(const std::size_t used_size) {
+      m_used_size = std::min(used_size, m_size);
+    }
+
+    [[nodiscard]] bool sync() const {
+#ifdef _WIN32
+      return FlushViewOfFile(m_data, 0) && FlushFileBuffers(m_file);
+#else
+      return ::msync(m_data, m_size, MS_SYNC) == 0;
+#endif
+    }
+
+  private:
+    explicit MappedFile(const std::size_t size):
+        m_size {size} {}
+
+    std::size_t m_size;
+    std::size_t m_used_size {0};
+    char *m_data {nullptr};
+#ifdef _WIN32
+    HANDLE m_file {INVALID_HANDLE_VALUE};
+    HANDLE m_mapping {nullptr};
+#else
+    int m_file {-1};
+#endif
+  };
+
+  MappedFileSink::MappedFileSink(std::filesystem::path filepath, const std::size_t max_file_size, const std::size_t backup_count):
+      m_filepath {std::move(filepath)},
+      m_max_file_size {max_file_size},
+      m_backup_count {backup_count} {
+    if (m_filepath.empty()) {
+      throw std::runtime_error {"Empty filename provided for MappedFileSink!"};
+    }
+
+    if (m_max_file_size == 0 || m_max_file_size > OFFSET_MASK / 2) {
+      throw std::runtime_error {"Invalid maximum file size provided for MappedFileSink!"};
+    }
+
+    if (std::error_code error_code; std::filesystem::file_size(m_filepath, error_code) > 0 && !error_code) {
+      rotateFiles();
+    }
+
+    m_file = MappedFile::create(m_filepath, m_max_file_size);
+    if (!m_file) {
+      throw std::runtime_error {"Failed to map the log file " + m_filepath.string() + "!"};
+    }
+    m_data = m_file->getData();
+  }
+
+  MappedFileSink::~MappedFileSink() {
+    if (m_file) {
+      m_file->setUsedSize(m_committed_size.load(std::memory_order_acquire));
+    }
+  }
+
+  void MappedFileSink::write(const Logger::LogLevel log_level, const std::string_view value) {
+    detail::TimestampBuffer timestamp_buffer;
+    detail::LogBuffer line;
+    line.append(detail::formatTimestamp(std::chrono::system_clock::now(), timestamp_buffer));
+    line.append(detail::getLogLevelPrefix(log_level));
+    line.append(value);
+    line.append("\n");
+
+    const auto text {line.view().substr(0, m_max_file_size)};
+    while (true) {
+      const auto state {m_state.fetch_add(text.size(), std::memory_order_acquire)};
+      const auto offset {state & OFFSET_MASK};
+      if (offset + text.size() <= m_max_file_size) {
+        if (m_data) {
+          std::memcpy(m_data + offset, text.data(), text.size());
+        }
+        m_committed_size.fetch_add(text.size(), std::memory_order_release);
+        return;
+      }
+
+      if (offset <= m_max_file_size) {
+        // We are the first one that did not fit, so it's up to us to switch the file
+        rotate(state);
+        continue;
+      }
+
+      // Someone else is switching the file, wait for the next generation
+      const auto generation {state >> GENERATION_SHIFT};
+      while ((m_state.load(std::memory_order_acquire) >> GENERATION_SHIFT) == generation) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  bool MappedFileSink::sync() {
+    std::lock_guard lock {m_rotation_mutex};
+    return m_file && m_file->sync();
+  }
+
+  void MappedFileSink::rotate(const std::uint64_t state) {
+    std::lock_guard lock {m_rotation_mutex};
+
+    // All of the reservations before ours fit into the file, wait until they are copied
+    const auto offset {static_cast<std::size_t>(state & OFFSET_MASK)};
+    while (m_committed_size.load(std::memory_order_acquire) < offset) {
+      std::this_thread::yield();
+    }
+
+    if (m_file) {
+      m_file->setUsedSize(offset);
+      m_file.reset();
+    }
+    rotateFiles();
+
+    m_file = MappedFile::create(m_filepath, m_max_file_size);
+    m_data = m_file ? m_file->getData() : nullptr;
+    m_committed_size.store(0, std::memory_order_relaxed);
+    m_state.store(((state >> GENERATION_SHIFT) + 1) << GENERATION_SHIFT, std::memory_order_release);
+  }
+
+  void MappedFileSink::rotateFiles() const {
+    // Errors are ignored on purpose - the worst case is that the older logs are overwritten
+    std::error_code error_code;
+    if (m_backup_count == 0) {
+      std::filesystem::remove(m_filepath, error_code);
+      return;
+    }
+
+    std::filesystem::remove(getBackupPath(m_filepath, m_backup_count), error_code);
+    for (std::size_t index {m_backup_count - 1}; index > 0; --index) {
+      std::filesystem::rename(getBackupPath(m_filepath, index), getBackupPath(m_filepath, index + 1), error_code);
+    }
+    std::filesystem::rename(m_filepath, getBackupPath(m_filepath, 1), error_code);
+  }
+}  // namespace display_device
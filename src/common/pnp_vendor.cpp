@@ -0,0 +1,235 @@
+/**
+ * @file src/common/pnp_vendor.cpp
+ * @brief Definitions for the PNP manufacturer name lookup.
+ */
+// header include
+#include "display_device/pnp_vendor.h"
+
+// system includes
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+namespace display_device {
+  namespace {
+    /**
+     * @brief A curated list of the display vendors that are commonly seen in the wild.
+     */
+    struct PnpVendor {
+      std::string_view m_id;
+      std::string_view m_name;
+    };
+
+    constexpr std::array PNP_VENDORS {
+      // clang-format off
+      PnpVendor {"ACI", "ASUSTeK Computer Inc."},
+      PnpVendor {"ACR", "Acer Technologies"},
+      PnpVendor {"AOC", "AOC International"},
+      PnpVendor {"APP", "Apple Computer Inc."},
+      PnpVendor {"AUO", "AU Optronics"},
+      PnpVendor {"AUS", "ASUSTeK Computer Inc."},
+      PnpVendor {"BBY", "Best Buy"},
+      PnpVendor {"BNQ", "BenQ Corporation"},
+      PnpVendor {"BOE", "BOE Technology Group"},
+      PnpVendor {"CMN", "Chimei Innolux Corporation"},
+      PnpVendor {"CMO", "Chi Mei Optoelectronics Corp."},
+      PnpVendor {"CPQ", "Compaq Computer Company"},
+      PnpVendor {"DEL", "Dell Inc."},
+      PnpVendor {"DON", "DENON, Ltd."},
+      PnpVendor {"DWE", "Daewoo Electronics Company Ltd."},
+      PnpVendor {"EIZ", "EIZO Corporation"},
+      PnpVendor {"ELO", "Elo TouchSystems Inc."},
+      PnpVendor {"ENC", "EIZO Corporation"},
+      PnpVendor {"EPI", "Envision Peripherals, Inc."},
+      PnpVendor {"FUS", "Fujitsu Siemens Computers GmbH"},
+      PnpVendor {"GBT", "GIGA-BYTE Technology Co., Ltd."},
+      PnpVendor {"GGL", "Google Inc."},
+      PnpVendor {"GSM", "LG Electronics"},
+      PnpVendor {"GWY", "Gateway 2000"},
+      PnpVendor {"HEI", "Hyundai Electronics Industries Co., Ltd."},
+      PnpVendor {"HIQ", "Hyundai ImageQuest"},
+      PnpVendor {"HIT", "Hitachi America Ltd."},
+      PnpVendor {"HPN", "HP Inc."},
+      PnpVendor {"HPQ", "Hewlett-Packard Co."},
+      PnpVendor {"HSD", "HannStar Display Corp."},
+      PnpVendor {"HTC", "Hitachi Ltd."},
+      PnpVendor {"HVR", "HTC Corporation"},
+      PnpVendor {"HWP", "Hewlett-Packard"},
+      PnpVendor {"IBM", "IBM Corporation"},
+      PnpVendor {"INL", "InnoLux Display Corporation"},
+      PnpVendor {"IVM", "Iiyama North America"},
+      PnpVendor {"IVO", "InfoVision Optoelectronics"},
+      PnpVendor {"KDS", "KDS USA"},
+      PnpVendor {"LEN", "Lenovo Group Limited"},
+      PnpVendor {"LGD", "LG Display"},
+      PnpVendor {"LNX", "The Linux Foundation"},
+      PnpVendor {"LPL", "LG Philips"},
+      PnpVendor {"MAG", "MAG InnoVision"},
+      PnpVendor {"MEI", "Panasonic Industry Company"},
+      PnpVendor {"MEL", "Mitsubishi Electric Corporation"},
+      PnpVendor {"MSI", "Micro-Star International"},
+      PnpVendor {"NAN", "Nanao Corporation"},
+      PnpVendor {"NEC", "NEC Corporation"},
+      PnpVendor {"NOK", "Nokia Display Products"},
+      PnpVendor {"NVD", "NVIDIA Corporation"},
+      PnpVendor {"ONK", "ONKYO Corporation"},
+      PnpVendor {"OVR", "Oculus VR, Inc."},
+      PnpVendor {"PGS", "Princeton Graphic Systems"},
+      PnpVendor {"PHL", "Philips Consumer Electronics Company"},
+      PnpVendor {"PIO", "Pioneer Electronic Corporation"},
+      PnpVendor {"PKB", "Packard Bell Electronics"},
+      PnpVendor {"QDS", "Quanta Display Inc."},
+      PnpVendor {"RHT", "Red Hat, Inc."},
+      PnpVendor {"SAM", "Samsung Electric Company"},
+      PnpVendor {"SDC", "Samsung Display Corp."},
+      PnpVendor {"SEC", "Seiko Epson Corporation"},
+      PnpVendor {"SGI", "Silicon Graphics Inc."},
+      PnpVendor {"SHP", "Sharp Corporation"},
+      PnpVendor {"SII", "Silicon Image, Inc."},
+      PnpVendor {"SNY", "Sony"},
+      PnpVendor {"SPT", "Sceptre Tech Inc."},
+      PnpVendor {"TOS", "Toshiba Corporation"},
+      PnpVendor {"TPV", "Top Victory Electronics"},
+      PnpVendor {"TSB", "Toshiba America Info Systems Inc."},
+      PnpVendor {"VES", "Vestel Elektronik Sanayi ve Ticaret A. S."},
+      PnpVendor {"VIZ", "VIZIO, Inc."},
+      PnpVendor {"VLV", "Valve Corporation"},
+      PnpVendor {"VMW", "VMware Inc."},
+      PnpVendor {"VSC", "ViewSonic Corporation"},
+      PnpVendor {"WAC", "Wacom Tech"},
+      // clang-format on
+    };
+
+    constexpr std::size_t BUCKET_COUNT {32};
+    constexpr std::size_t SLOT_COUNT {128};
+    static_assert(PNP_VENDORS.size() < SLOT_COUNT, "Too many vendors for the perfect hash table!");
+
+    /**
+     * @brief Pack the 3-letter ID into 15 bits (5 bits per letter, the same way it is encoded in EDID).
+     * @returns Packed code or 0 if the ID is invalid.
+     */
+    constexpr std::uint16_t packPnpId(const std::string_view pnp_id) {
+      if (pnp_id.size() != 3) {
+        return 0;
+      }
+
+      std::uint16_t code {0};
+      for (const char ch : pnp_id) {
+        if (ch < 'A' || ch > 'Z') {
+          return 0;
+        }
+        code = static_cast<std::uint16_t>(code << 5 | (ch - '@'));
+      }
+      return code;
+    }
+
+    constexpr std::uint32_t mix(std::uint32_t key, const std::uint32_t seed) {
+      key ^= seed * 0x9E3779B9u;
+      key *= 0x85EBCA6Bu;
+      key ^= key >> 13;
+      key *= 0xC2B2AE35u;
+      key ^= key >> 16;
+      return key;
+    }
+
+    constexpr std::size_t getBucket(const std::uint16_t code) {
+      return mix(code, 0) % BUCKET_COUNT;
+    }
+
+    constexpr std::size_t getSlot(const std::uint16_t code, const std::uint8_t displacement) {
+      return mix(code, displacement + 1u) % SLOT_COUNT;
+    }
+
+    /**
+     * @brief A "hash and displace" perfect hash table: every bucket stores the seed
+     *        that maps all of its keys to otherwise unused slots.
+     */
+    struct PerfectHashTable {
+      std::array<std::uint16_t, PNP_VENDORS.size()> m_codes {}; /**< Packed codes in the vendor list order. */
+      std::array<std::uint8_t, BUCKET_COUNT> m_displacements {}; /**< Per-bucket slot seeds. */
+      std::array<std::uint8_t, SLOT_COUNT> m_slots {}; /**< Vendor index + 1, or 0 for an empty slot. */
+    };
+
+    constexpr PerfectHashTable buildTable() {
+      PerfectHashTable table {};
+      std::array<std::size_t, BUCKET_COUNT> bucket_sizes {};
+      for (std::size_t i {0}; i < PNP_VENDORS.size(); ++i) {
+        table.m_codes[i] = packPnpId(PNP_VENDORS[i].m_id);
+        if (table.m_codes[i] == 0) {
+          throw std::logic_error {"Invalid PNP ID in the vendor table!"};
+        }
+        for (std::size_t j {0}; j < i; ++j) {
+          if (table.m_codes[i] == table.m_codes[j]) {
+            throw std::logic_error {"Duplicate PNP ID in the vendor table!"};
+          }
+        }
+        ++bucket_sizes[getBucket(table.m_codes[i])];
+      }
+
+      // Place the largest buckets first, while there is still a lot of free slots
+      for (std::size_t size {PNP_VENDORS.size()}; size > 0; --size) {
+        for (std::size_t bucket {0}; bucket < BUCKET_COUNT; ++bucket) {
+          if (bucket_sizes[bucket] != size) {
+            continue;
+          }
+
+          bool placed {false};
+          for (unsigned int displacement {0}; displacement <= 0xFF && !placed; ++displacement) {
+            auto slots {table.m_slots};
+            placed = true;
+            for (std::size_t i {0}; i < PNP_VENDORS.size() && placed; ++i) {
+              if (getBucket(table.m_codes[i]) != bucket) {
+                continue;
+              }
+
+              auto &slot {slots[getSlot(table.m_codes[i], static_cast<std::uint8_t>(displacement))]};
+              placed = slot == 0;
+              slot = static_cast<std::uint8_t>(i + 1);
+            }
+
+            if (placed) {
+              table.m_slots = slots;
+              table.m_displacements[bucket] = static_cast<std::uint8_t>(displacement);
+            }
+          }
+
+          if (!placed) {
+            throw std::logic_error {"Failed to build the perfect hash table, increase the slot count!"};
+          }
+        }
+      }
+
+      return table;
+    }
+
+    constexpr PerfectHashTable PNP_TABLE {buildTable()};
+
+    constexpr std::string_view findVendorName(const std::string_view pnp_id) {
+      const auto code {packPnpId(pnp_id)};
+      if (code == 0) {
+        return {};
+      }
+
+      const auto index {PNP_TABLE.m_slots[getSlot(code, PNP_TABLE.m_displacements[getBucket(code)])]};
+      if (index == 0 || PNP_TABLE.m_codes[index - 1] != code) {
+        return {};
+      }
+      return PNP_VENDORS[index - 1].m_name;
+    }
+
+    constexpr bool allVendorsFound() {
+      for (const auto &vendor : PNP_VENDORS) {
+        if (findVendorName(vendor.m_id) != vendor.m_name) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    static_assert(allVendorsFound(), "Perfect hash table is broken!");
+  }  // namespace
+
+  std::string_view getPnpVendorName(const std::string_view pnp_id) {
+    return findVendorName(pnp_id);
+  }
+}  // namespace display_device
@@ -0,0 +1,128 @@
+/**
+ * @file src/common/scheduler_timer_service.cpp
+ * @brief Definitions for the timer service shared between the RetrySchedulers.
+ */
+// header include
+#include "display_device/scheduler_timer_service.h"
+
+// system includes
+#include <algorithm>
+#include <stdexcept>
+
+namespace display_device {
+  SchedulerTimerService::SchedulerTimerService():
+      m_thread {[this]() {
+        run();
+      }} {
+  }
+
+  SchedulerTimerService::~SchedulerTimerService() {
+    {
+      std::lock_guard lock {m_mutex};
+      m_keep_alive = false;
+      m_syncing_thread = true;
+      m_sleep_cv.notify_one();
+    }
+
+    m_thread.join();
+  }
+
+  SchedulerTimerService::ClientId SchedulerTimerService::registerClient(Callback callback) {
+    if (!callback) {
+      throw std::logic_error {"Empty callback function provided in SchedulerTimerService::registerClient!"};
+    }
+
+    std::lock_guard lock {m_mutex};
+    const auto id {m_next_client_id++};
+    m_clients[id].m_callback = std::move(callback);
+    return id;
+  }
+
+  void SchedulerTimerService::unregisterClient(const ClientId id) {
+    std::unique_lock lock {m_mutex};
+    m_clients.erase(id);
+    m_client_done_cv.wait(lock, [this, id]() {
+      return m_running_client_id != id;
+    });
+  }
+
+  void SchedulerTimerService::setDeadline(const ClientId id, const std::optional<Clock::time_point> deadline) {
+    std::lock_guard lock {m_mutex};
+    if (const auto client_it {m_clients.find(id)}; client_it != std::end(m_clients)) {
+      setDeadlineUnlocked(id, client_it->second, deadline);
+    }
+  }
+
+  void SchedulerTimerService::run() {
+    std::unique_lock lock {m_mutex};
+    while (m_keep_alive) {
+      m_syncing_thread = false;
+      dropStaleDeadlinesUnlocked();
+      if (m_deadlines.empty()) {
+        // We're going to sleep until manually woken up.
+        m_sleep_cv.wait(lock, [this]() {
+          return m_syncing_thread;
+        });
+      } else {
+        // We're going to sleep until manually woken up or the earliest deadline is reached.
+        m_sleep_cv.wait_until(lock, m_deadlines.front().m_time, [this]() {
+          return m_syncing_thread;
+        });
+      }
+
+      if (m_syncing_thread || m_deadlines.empty() || m_deadlines.front().m_time > Clock::now()) {
+        // Thread was waken up to sync sleep time, to be stopped or just a little too early.
+        continue;
+      }
+
+      std::ranges::pop_heap(m_deadlines, std::greater {});
+      const auto deadline {m_deadlines.back()};
+      m_deadlines.pop_back();
+
+      auto client_it {m_clients.find(deadline.m_client_id)};
+      if (client_it == std::end(m_clients) || client_it->second.m_generation != deadline.m_generation) {
+        continue;
+      }
+
+      // The callback locks the client's own mutex, so ours must not be held to avoid the deadlock
+      // with the client that is setting a new deadline while holding its mutex.
+      const auto callback {client_it->second.m_callback};
+      m_running_client_id = deadline.m_client_id;
+      lock.unlock();
+      const auto next_deadline {callback()};
+      lock.lock();
+      m_running_client_id = std::nullopt;
+      m_client_done_cv.notify_all();
+
+      client_it = m_clients.find(deadline.m_client_id);
+      if (client_it != std::end(m_clients) && client_it->second.m_generation == deadline.m_generation) {
+        // The deadline was not changed in the meantime by the client itself
+        setDeadlineUnlocked(deadline.m_client_id, client_it->second, next_deadline);
+      }
+    }
+  }
+
+  void SchedulerTimerService::setDeadlineUnlocked(const ClientId id, Client &client, const std::optional<Clock::time_point> deadline) {
+    ++client.m_generation;
+    if (deadline) {
+      m_deadlines.push_back({*deadline, id, client.m_generation});
+      std::ranges::push_heap(m_deadlines, std::greater {});
+    }
+
+    m_syncing_thread = true;
+    m_sleep_cv.notify_one();
+  }
+
+  void SchedulerTimerService::dropStaleDeadlinesUnlocked() {
+    while (!m_deadlines.empty()) {
+      const auto &deadline {m_deadlines.front()};
+      const auto client_it {m_clients.find(deadline.m_client_id)};
+      if (client_it != std::end(m_clients) && client_it->second.m_generation == deadline.m_generation) {
+        break;
+      }
+
+      std::ranges::pop_heap(m_deadlines, std::greater {});
+      m_deadlines.pop_back();
+    }
+  }
+}  // namespace display_device
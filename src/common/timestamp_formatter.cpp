@@ -0,0 +1,60 @@
+/**
+ * @file src/common/timestamp_formatter.cpp
+ * @brief Definitions for the log timestamp formatting helper.
+ */
+#if !defined(_MSC_VER) && !defined(_POSIX_THREAD_SAFE_FUNCTIONS)
+  #define _POSIX_THREAD_SAFE_FUNCTIONS  // For localtime_r
+#endif
+
+// header include
+#include "display_device/detail/timestamp_formatter.h"
+
+// system includes
+#include <algorithm>
+#include <ctime>
+
+namespace display_device::detail {
+  namespace {
+    std::tm threadSafeLocaltime(const std::time_t &time) {
+#if defined(_MSC_VER)  // MSVCRT (2005+): std::localtime is threadsafe
+      const auto tm_ptr {std::localtime(&time)};
+#else  // POSIX
+      std::tm buffer;
+      const auto tm_ptr {localtime_r(&time, &buffer)};
+#endif  // _MSC_VER
+      if (tm_ptr) {
+        return *tm_ptr;
+      }
+      return {};
+    }
+
+    /**
+     * @brief The "[%Y-%m-%d %H:%M:%S." part of the timestamp for the last formatted second.
+     */
+    struct PrefixCache {
+      std::chrono::system_clock::time_point m_second {std::chrono::system_clock::time_point::min()};
+      std::array<char, std::tuple_size_v<TimestampBuffer> - 8> m_prefix {};
+      std::size_t m_size {0};
+    };
+  }  // namespace
+
+  std::string_view formatTimestamp(const std::chrono::system_clock::time_point time, TimestampBuffer &buffer) {
+    thread_local PrefixCache cache;
+
+    const auto second {std::chrono::floor<std::chrono::seconds>(time)};
+    if (second != cache.m_second) {
+      const auto localtime {threadSafeLocaltime(std::chrono::system_clock::to_time_t(second))};
+      cache.m_size = std::strftime(cache.m_prefix.data(), cache.m_prefix.size(), "[%Y-%m-%d %H:%M:%S.", &localtime);
+      cache.m_second = second;
+    }
+
+    const auto milliseconds {std::chrono::duration_cast<std::chrono::milliseconds>(time - second).count()};
+    auto it {std::copy_n(std::begin(cache.m_prefix), cache.m_size, std::begin(buffer))};
+    *it++ = static_cast<char>('0' + milliseconds / 100);
+    *it++ = static_cast<char>('0' + milliseconds / 10 % 10);
+    *it++ = static_cast<char>('0' + milliseconds % 10);
+    *it++ = ']';
+    *it++ = ' ';
+    return {buffer.data(), static_cast<std::size_t>(it - std::begin(buffer))};
+  }
+}  // namespace display_device::detail
@@ -34,7 +34,7 @@ namespace display_device {
         throw std::runtime_error {error_message};
       }
 
-      DD_LOG(error) << error_message;
+      DD_LOG_CATEGORY(persistence, error) << error_message;
       m_cached_state = std::nullopt;
     }
   }
@@ -56,8 +56,8 @@ namespace display_device {
     bool success {false};
     const auto json_string {toJson(*state, 2, &success)};
     if (!success) {
-      DD_LOG(error) << "Failed to serialize new persistent state! Error:\n"
-                    << json_string;
+      DD_LOG_CATEGORY(persistence, error) << "Failed to serialize new persistent state! Error:\n"
+                                          << json_string;
       return false;
     }
 
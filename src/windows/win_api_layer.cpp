@@ -141,7 +141,7 @@ namespace display_device {
 
       LONG result {DisplayConfigGetDeviceInfo(&target_name.header)};
       if (result != ERROR_SUCCESS) {
-        DD_LOG(error) << w_api.getErrorString(result) << " failed to get target device name!";
+        DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(result) << " failed to get target device name!";
         return {};
       }
 
@@ -156,10 +156,10 @@ namespace display_device {
     bool getDeviceInterfaceDetail(const WinApiLayerInterface &w_api, HDEVINFO dev_info_handle, SP_DEVICE_INTERFACE_DATA &dev_interface_data, std::wstring &dev_interface_path, SP_DEVINFO_DATA &dev_info_data) {
       DWORD required_size_in_bytes {0};
       if (SetupDiGetDeviceInterfaceDetailW(dev_info_handle, &dev_interface_data, nullptr, 0, &required_size_in_bytes, nullptr)) {
-        DD_LOG(error) << "\"SetupDiGetDeviceInterfaceDetailW\" did not fail, what?!";
+        DD_LOG_CATEGORY(platform, error) << "\"SetupDiGetDeviceInterfaceDetailW\" did not fail, what?!";
         return false;
       } else if (required_size_in_bytes <= 0) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInterfaceDetailW\" failed while getting size.";
+        DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInterfaceDetailW\" failed while getting size.";
         return false;
       }
 
@@ -171,7 +171,7 @@ namespace display_device {
       detail_data->cbSize = sizeof(SP_DEVICE_INTERFACE_DETAIL_DATA_W);
 
       if (!SetupDiGetDeviceInterfaceDetailW(dev_info_handle, &dev_interface_data, detail_data, required_size_in_bytes, nullptr, &dev_info_data)) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInterfaceDetailW\" failed.";
+        DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInterfaceDetailW\" failed.";
         return false;
       }
 
@@ -187,16 +187,16 @@ namespace display_device {
     bool getDeviceInstanceId(const WinApiLayerInterface &w_api, HDEVINFO dev_info_handle, SP_DEVINFO_DATA &dev_info_data, std::wstring &instance_id) {
       DWORD required_size_in_characters {0};
       if (SetupDiGetDeviceInstanceIdW(dev_info_handle, &dev_info_data, nullptr, 0, &required_size_in_characters)) {
-        DD_LOG(error) << "\"SetupDiGetDeviceInstanceIdW\" did not fail, what?!";
+        DD_LOG_CATEGORY(platform, error) << "\"SetupDiGetDeviceInstanceIdW\" did not fail, what?!";
         return false;
       } else if (required_size_in_characters <= 0) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInstanceIdW\" failed while getting size.";
+        DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInstanceIdW\" failed while getting size.";
         return false;
       }
 
       instance_id.resize(required_size_in_characters);
       if (!SetupDiGetDeviceInstanceIdW(dev_info_handle, &dev_info_data, instance_id.data(), instance_id.size(), nullptr)) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInstanceIdW\" failed.";
+        DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiGetDeviceInstanceIdW\" failed.";
         return false;
       }
 
@@ -212,7 +212,7 @@ namespace display_device {
       // We could just directly open the registry key as the path is known, but we can also use the this
       HKEY reg_key {SetupDiOpenDevRegKey(dev_info_handle, &dev_info_data, DICS_FLAG_GLOBAL, 0, DIREG_DEV, KEY_READ)};
       if (reg_key == INVALID_HANDLE_VALUE) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiOpenDevRegKey\" failed.";
+        DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiOpenDevRegKey\" failed.";
         return false;
       }
 
@@ -220,7 +220,7 @@ namespace display_device {
         boost::scope::scope_exit([&w_api, &reg_key]() {
           const auto status {RegCloseKey(reg_key)};
           if (status != ERROR_SUCCESS) {
-            DD_LOG(error) << w_api.getErrorString(status) << " \"RegCloseKey\" failed.";
+            DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(status) << " \"RegCloseKey\" failed.";
           }
         })
       };
@@ -228,7 +228,7 @@ namespace display_device {
       DWORD required_size_in_bytes {0};
       auto status {RegQueryValueExW(reg_key, L"EDID", nullptr, nullptr, nullptr, &required_size_in_bytes)};
       if (status != ERROR_SUCCESS) {
-        DD_LOG(error) << w_api.getErrorString(status) << " \"RegQueryValueExW\" failed when getting size.";
+        DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(status) << " \"RegQueryValueExW\" failed when getting size.";
         return false;
       }
 
@@ -236,7 +236,7 @@ namespace display_device {
 
       status = RegQueryValueExW(reg_key, L"EDID", nullptr, nullptr, reinterpret_cast<LPBYTE>(edid.data()), &required_size_in_bytes);
       if (status != ERROR_SUCCESS) {
-        DD_LOG(error) << w_api.getErrorString(status) << " \"RegQueryValueExW\" failed when getting data.";
+        DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(status) << " \"RegQueryValueExW\" failed when getting data.";
         return false;
       }
 
@@ -257,7 +257,7 @@ namespace display_device {
         const auto dev_info_handle_cleanup {
           boost::scope::scope_exit([&dev_info_handle, &w_api]() {
             if (!SetupDiDestroyDeviceInfoList(dev_info_handle)) {
-              DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiDestroyDeviceInfoList\" failed.";
+              DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"SetupDiDestroyDeviceInfoList\" failed.";
             }
           })
         };
@@ -271,7 +271,7 @@ namespace display_device {
               break;
             }
 
-            DD_LOG(warning) << w_api.getErrorString(static_cast<LONG>(error_code)) << " \"SetupDiEnumDeviceInterfaces\" failed.";
+            DD_LOG_CATEGORY(platform, warning) << w_api.getErrorString(static_cast<LONG>(error_code)) << " \"SetupDiEnumDeviceInterfaces\" failed.";
             continue;
           }
 
@@ -321,7 +321,7 @@ namespace display_device {
       // Get the output size required to store the string
       auto output_size = WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, value.data(), static_cast<int>(value.size()), nullptr, 0, nullptr, nullptr);
       if (output_size == 0) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " failed to get UTF-8 buffer size.";
+        DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " failed to get UTF-8 buffer size.";
         return {};
       }
 
@@ -329,7 +329,7 @@ namespace display_device {
       std::string output(output_size, '\0');
       output_size = WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, value.data(), static_cast<int>(value.size()), output.data(), static_cast<int>(output.size()), nullptr, nullptr);
       if (output_size == 0) {
-        DD_LOG(error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " failed to convert string to UTF-8.";
+        DD_LOG_CATEGORY(platform, error) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " failed to convert string to UTF-8.";
         return {};
       }
 
@@ -355,11 +355,11 @@ namespace display_device {
 
       BOOL result {VerifyVersionInfoA(&os_version_info, VER_MAJORVERSION | VER_MINORVERSION | VER_BUILDNUMBER, condition_mask)};
       if (result == FALSE) {
-        DD_LOG(verbose) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"is_W11_24H2_OrAbove\" returned false.";
+        DD_LOG_CATEGORY(platform, verbose) << w_api.getErrorString(static_cast<LONG>(GetLastError())) << " \"is_W11_24H2_OrAbove\" returned false.";
         return false;
       }
 
-      DD_LOG(verbose) << "\"is_W11_24H2_OrAbove\" returned true.";
+      DD_LOG_CATEGORY(platform, verbose) << "\"is_W11_24H2_OrAbove\" returned true.";
       return true;
     }
   }  // namespace
@@ -410,7 +410,7 @@ namespace display_device {
 
       result = GetDisplayConfigBufferSizes(flags, &path_count, &mode_count);
       if (result != ERROR_SUCCESS) {
-        DD_LOG(error) << getErrorString(result) << " failed to get display paths and modes!";
+        DD_LOG_CATEGORY(platform, error) << getErrorString(result) << " failed to get display paths and modes!";
         return std::nullopt;
       }
 
@@ -427,12 +427,12 @@ namespace display_device {
     } while (result == ERROR_INSUFFICIENT_BUFFER);
 
     if (result != ERROR_SUCCESS) {
-      DD_LOG(error) << getErrorString(result) << " failed to query display paths and modes!";
+      DD_LOG_CATEGORY(platform, error) << getErrorString(result) << " failed to query display paths and modes!";
       return std::nullopt;
     }
 
-    DD_LOG(verbose) << "Result of " << (type == QueryType::Active ? "ACTIVE" : "ALL") << " display config query:\n"
-                    << dumpPathsAndModes(paths, modes) << "\n";
+    DD_LOG_CATEGORY(platform, verbose) << "Result of " << (type == QueryType::Active ? "ACTIVE" : "ALL") << " display config query:\n"
+                                       << dumpPathsAndModes(paths, modes) << "\n";
     return PathAndModeData {paths, modes};
   }
 
@@ -469,13 +469,13 @@ namespace display_device {
         }
 
         if (unstable_part_index == std::wstring::npos) {
-          DD_LOG(error) << "Failed to split off the stable part from instance id string " << toUtf8(*this, instance_id);
+          DD_LOG_CATEGORY(platform, error) << "Failed to split off the stable part from instance id string " << toUtf8(*this, instance_id);
           return;
         }
 
         auto semi_stable_part_index = instance_id.find_first_of(L'&', unstable_part_index + 1);
         if (semi_stable_part_index == std::wstring::npos) {
-          DD_LOG(error) << "Failed to split off the semi-stable part from instance id string " << toUtf8(*this, instance_id);
+          DD_LOG_CATEGORY(platform, error) << "Failed to split off the semi-stable part from instance id string " << toUtf8(*this, instance_id);
           return;
         }
 
@@ -500,13 +500,13 @@ namespace display_device {
 
           return output.str();
         }};
-        DD_LOG(verbose) << "Creating device id from EDID + instance ID: " << dump_device_id_data(device_id_data);
+        DD_LOG_CATEGORY(platform, verbose) << "Creating device id from EDID + instance ID: " << dump_device_id_data(device_id_data);
       }();
     }
 
     if (device_id_data.empty()) {
       // Using the device path as a fallback, which is always unique, but not as stable as the preferred one
-      DD_LOG(verbose) << "Creating device id from path " << toUtf8(*this, device_path);
+      DD_LOG_CATEGORY(platform, verbose) << "Creating device id from path " << toUtf8(*this, device_path);
       device_id_data.insert(std::end(device_id_data), reinterpret_cast<const std::byte *>(device_path.data()), reinterpret_cast<const std::byte *>(device_path.data() + device_path.size()));
     }
 
@@ -514,7 +514,7 @@ namespace display_device {
     const auto boost_uuid {boost::uuids::name_generator_sha1 {ns_id}(device_id_data.data(), device_id_data.size())};
     const std::string device_id {"{" + boost::uuids::to_string(boost_uuid) + "}"};
 
-    DD_LOG(verbose) << "Created device id: " << toUtf8(*this, device_path) << " -> " << device_id;
+    DD_LOG_CATEGORY(platform, verbose) << "Created device id: " << toUtf8(*this, device_path) << " -> " << device_id;
     return device_id;
   }
 
@@ -542,7 +542,7 @@ namespace display_device {
 
     LONG result {DisplayConfigGetDeviceInfo(&target_name.header)};
     if (result != ERROR_SUCCESS) {
-      DD_LOG(error) << getErrorString(result) << " failed to get target device name!";
+      DD_LOG_CATEGORY(platform, error) << getErrorString(result) << " failed to get target device name!";
       return {};
     }
 
@@ -558,7 +558,7 @@ namespace display_device {
 
     LONG result {DisplayConfigGetDeviceInfo(&source_name.header)};
     if (result != ERROR_SUCCESS) {
-      DD_LOG(error) << getErrorString(result) << " failed to get display name!";
+      DD_LOG_CATEGORY(platform, error) << getErrorString(result) << " failed to get display name!";
       return {};
     }
 
@@ -586,7 +586,7 @@ namespace display_device {
 
       LONG result {DisplayConfigGetDeviceInfo(&color_info.header)};
       if (result != ERROR_SUCCESS) {
-        DD_LOG(error) << getErrorString(result) << " failed to get advanced color info 2!";
+        DD_LOG_CATEGORY(platform, error) << getErrorString(result) << " failed to get advanced color info 2!";
         return std::nullopt;
       }
 
@@ -601,7 +601,7 @@ namespace display_device {
 
     LONG result {DisplayConfigGetDeviceInfo(&color_info.header)};
     if (result != ERROR_SUCCESS) {
-      DD_LOG(error) << getErrorString(result) << " failed to get advanced color info!";
+      DD_LOG_CATEGORY(platform, error) << getErrorString(result) << " failed to get advanced color info!";
       return std::nullopt;
     }
 
@@ -619,7 +619,7 @@ namespace display_device {
 
       LONG result {DisplayConfigSetDeviceInfo(&hdr_state.header)};
       if (result != ERROR_SUCCESS) {
-        DD_LOG(error) << getErrorString(result) << " failed to set HDR state!";
+        DD_LOG_CATEGORY(platform, error) << getErrorString(result) << " failed to set HDR state!";
         return false;
       }
 
@@ -635,7 +635,7 @@ namespace display_device {
 
     LONG result {DisplayConfigSetDeviceInfo(&color_state.header)};
     if (result != ERROR_SUCCESS) {
-      DD_LOG(error) << getErrorString(result) << " failed to set advanced color info!";
+      DD_LOG_CATEGORY(platform, error) << getErrorString(result) << " failed to set advanced color info!";
       return false;
     }
 
@@ -657,7 +657,7 @@ namespace display_device {
         auto *data = reinterpret_cast<EnumData *>(user_data);
         if (data == nullptr) {
           // Sanity check
-          DD_LOG(error) << "EnumData is a nullptr!";
+          DD_LOG_CATEGORY(platform, error) << "EnumData is a nullptr!";
           return FALSE;
         }
 
@@ -675,12 +675,12 @@ namespace display_device {
     );
 
     if (!enum_data.m_width) {
-      DD_LOG(debug) << "Failed to get monitor info for " << display_name << "!";
+      DD_LOG_CATEGORY(platform, debug) << "Failed to get monitor info for " << display_name << "!";
       return std::nullopt;
     }
 
     if (*enum_data.m_width * source_mode.width == 0) {
-      DD_LOG(debug) << "Cannot get display scale for " << display_name << " from a width of 0!";
+      DD_LOG_CATEGORY(platform, debug) << "Cannot get display scale for " << display_name << " from a width of 0!";
       return std::nullopt;
     }
 
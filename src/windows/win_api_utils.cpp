@@ -86,7 +86,7 @@ namespace display_device::win_utils {
     }
 
     if (index >= modes.size()) {
-      DD_LOG(error) << "Source index " << index << " is out of range " << modes.size();
+      DD_LOG_CATEGORY(platform, error) << "Source index " << index << " is out of range " << modes.size();
       return std::nullopt;
     }
 
@@ -159,13 +159,13 @@ namespace display_device::win_utils {
     }
 
     if (*index >= modes.size()) {
-      DD_LOG(error) << "Source index " << *index << " is out of range " << modes.size();
+      DD_LOG_CATEGORY(platform, error) << "Source index " << *index << " is out of range " << modes.size();
       return nullptr;
     }
 
     const auto &mode {modes[*index]};
     if (mode.infoType != DISPLAYCONFIG_MODE_INFO_TYPE_SOURCE) {
-      DD_LOG(error) << "Mode at index " << *index << " is not source mode!";
+      DD_LOG_CATEGORY(platform, error) << "Mode at index " << *index << " is not source mode!";
       return nullptr;
     }
 
@@ -241,13 +241,13 @@ namespace display_device::win_utils {
       const auto prev_device_id_for_path_it {paths_to_ids.find(device_info->m_device_path)};
       if (prev_device_id_for_path_it != std::end(paths_to_ids)) {
         if (prev_device_id_for_path_it->second != device_info->m_device_id) {
-          DD_LOG(error) << "Duplicate display device id found: " << device_info->m_device_id << " (device path: " << device_info->m_device_path << ")";
+          DD_LOG_CATEGORY(platform, error) << "Duplicate display device id found: " << device_info->m_device_id << " (device path: " << device_info->m_device_path << ")";
           return {};
         }
       } else {
         for (const auto &[device_path, device_id] : paths_to_ids) {
           if (device_id == device_info->m_device_id) {
-            DD_LOG(error) << "Device id " << device_info->m_device_id << " is shared between 2 different paths: " << device_path << " and " << device_info->m_device_path;
+            DD_LOG_CATEGORY(platform, error) << "Device id " << device_info->m_device_id << " is shared between 2 different paths: " << device_path << " and " << device_info->m_device_path;
             return {};
           }
         }
@@ -259,15 +259,15 @@ namespace display_device::win_utils {
       if (path_data_it != std::end(path_data)) {
         if (path_data_it->second.m_adapter_id != path.sourceInfo.adapterId) {
           // Sanity check, should not be possible since adapter in embedded in the device path
-          DD_LOG(error) << "Device path " << device_info->m_device_path << " has different adapters!";
+          DD_LOG_CATEGORY(platform, error) << "Device path " << device_info->m_device_path << " has different adapters!";
           return {};
         } else if (isActive(path)) {
           // Sanity check, should not be possible as all active paths are in the front
-          DD_LOG(error) << "Device path " << device_info->m_device_path << " is active, but not the first entry in the list!";
+          DD_LOG_CATEGORY(platform, error) << "Device path " << device_info->m_device_path << " is active, but not the first entry in the list!";
           return {};
         } else if (path_data_it->second.m_source_id_to_path_index.contains(path.sourceInfo.id)) {
           // Sanity check, should not be possible unless Windows goes bonkers
-          DD_LOG(error) << "Device path " << device_info->m_device_path << " has duplicate source ids!";
+          DD_LOG_CATEGORY(platform, error) << "Device path " << device_info->m_device_path << " has duplicate source ids!";
           return {};
         }
 
@@ -281,11 +281,11 @@ namespace display_device::win_utils {
         };
       }
 
-      DD_LOG(verbose) << "Device " << device_info->m_device_id << " (active: " << isActive(path) << ") at index " << index << " added to the source data list.";
+      DD_LOG_CATEGORY(platform, verbose) << "Device " << device_info->m_device_id << " (active: " << isActive(path) << ") at index " << index << " added to the source data list.";
     }
 
     if (path_data.empty()) {
-      DD_LOG(error) << "Failed to collect path source data or none was available!";
+      DD_LOG_CATEGORY(platform, error) << "Failed to collect path source data or none was available!";
     }
     return path_data;
   }
@@ -318,7 +318,7 @@ namespace display_device::win_utils {
       for (const std::string &device_id : group) {
         auto path_source_data_it {path_source_data.find(device_id)};
         if (path_source_data_it == std::end(path_source_data)) {
-          DD_LOG(error) << "Device " << device_id << " does not exist in the available path source data!";
+          DD_LOG_CATEGORY(platform, error) << "Device " << device_id << " does not exist in the available path source data!";
           return {};
         }
 
@@ -331,7 +331,7 @@ namespace display_device::win_utils {
           // This means we must also use the path with matching source id.
           auto path_index_it {source_data.m_source_id_to_path_index.find(*already_used_source_id)};
           if (path_index_it == std::end(source_data.m_source_id_to_path_index)) {
-            DD_LOG(error) << "Device " << device_id << " does not have a path with a source id " << *already_used_source_id << "!";
+            DD_LOG_CATEGORY(platform, error) << "Device " << device_id << " does not have a path with a source id " << *already_used_source_id << "!";
             return {};
           }
 
@@ -361,7 +361,7 @@ namespace display_device::win_utils {
             // has to render them, so I don't know how this 4 source limitation makes sense then?
             //
             // In short, this arbitrary limitation should not affect virtual displays when the GPU is at its limit.
-            DD_LOG(error) << "Device " << device_id << " cannot be enabled as the adapter has no more free source ids (GPU limitation)!";
+            DD_LOG_CATEGORY(platform, error) << "Device " << device_id << " cannot be enabled as the adapter has no more free source ids (GPU limitation)!";
             return {};
           }
 
@@ -371,7 +371,7 @@ namespace display_device::win_utils {
         }
 
         if (selected_path_index >= paths.size()) {
-          DD_LOG(error) << "Selected path index " << selected_path_index << " is out of range! List size: " << paths.size();
+          DD_LOG_CATEGORY(platform, error) << "Selected path index " << selected_path_index << " is out of range! List size: " << paths.size();
           return {};
         }
 
@@ -391,7 +391,7 @@ namespace display_device::win_utils {
     }
 
     if (new_paths.empty()) {
-      DD_LOG(error) << "Failed to make paths for new topology!";
+      DD_LOG_CATEGORY(platform, error) << "Failed to make paths for new topology!";
     }
     return new_paths;
   }
@@ -406,19 +406,19 @@ namespace display_device::win_utils {
     std::set<std::string> all_device_ids;
     for (const auto &device_id : device_ids) {
       if (device_id.empty()) {
-        DD_LOG(error) << "Device it is empty!";
+        DD_LOG_CATEGORY(platform, error) << "Device it is empty!";
         return {};
       }
 
       const auto provided_path {getActivePath(w_api, device_id, display_data->m_paths)};
       if (!provided_path) {
-        DD_LOG(warning) << "Failed to find device for " << device_id << "!";
+        DD_LOG_CATEGORY(platform, warning) << "Failed to find device for " << device_id << "!";
         return {};
       }
 
       const auto provided_path_source_mode {getSourceMode(getSourceIndex(*provided_path, display_data->m_modes), display_data->m_modes)};
       if (!provided_path_source_mode) {
-        DD_LOG(error) << "Active device does not have a source mode: " << device_id << "!";
+        DD_LOG_CATEGORY(platform, error) << "Active device does not have a source mode: " << device_id << "!";
         return {};
       }
 
@@ -437,7 +437,7 @@ namespace display_device::win_utils {
 
         const auto source_mode {getSourceMode(getSourceIndex(path, display_data->m_modes), display_data->m_modes)};
         if (!source_mode) {
-          DD_LOG(error) << "Active device does not have a source mode: " << device_info->m_device_id << "!";
+          DD_LOG_CATEGORY(platform, error) << "Active device does not have a source mode: " << device_info->m_device_id << "!";
           return {};
         }
 
@@ -6,6 +6,7 @@
 #include "display_device/windows/win_display_device.h"
 
 // local includes
+#include "display_device/edid_cache.h"
 #include "display_device/logging.h"
 #include "display_device/windows/win_api_utils.h"
 
@@ -23,7 +24,7 @@ namespace display_device {
     const UINT32 flags {SDC_VALIDATE | SDC_USE_DATABASE_CURRENT};
     const LONG result {m_w_api->setDisplayConfig({}, {}, flags)};
 
-    DD_LOG(debug) << "WinDisplayDevice::isApiAccessAvailable result: " << m_w_api->getErrorString(result);
+    DD_LOG_CATEGORY(platform, debug) << "WinDisplayDevice::isApiAccessAvailable result: " << m_w_api->getErrorString(result);
     return result == ERROR_SUCCESS;
   }
 
@@ -48,10 +49,11 @@ namespace display_device {
       const bool is_active {win_utils::isActive(best_path)};
       const auto source_mode {is_active ? win_utils::getSourceMode(win_utils::getSourceIndex(best_path, display_data->m_modes), display_data->m_modes) : nullptr};
       const auto display_name {is_active ? m_w_api->getDisplayName(best_path) : std::string {}};  // Inactive devices can have multiple display names, so it's just meaningless use any
-      const auto edid {EdidData::parse(m_w_api->getEdid(best_path))};
+      const auto cached_edid {EdidCache::get().parse(m_w_api->getEdid(best_path))};
+      const auto edid {cached_edid ? std::make_optional(*cached_edid) : std::nullopt};
 
       if (is_active && !source_mode) {
-        DD_LOG(warning) << "Device " << device_id << " is missing source mode!";
+        DD_LOG_CATEGORY(platform, warning) << "Device " << device_id << " is missing source mode!";
       }
 
       if (source_mode) {
@@ -101,14 +103,14 @@ namespace display_device {
     const auto path {win_utils::getActivePath(*m_w_api, device_id, display_data->m_paths)};
     if (!path) {
       // Debug level, because inactive device is valid case for this function
-      DD_LOG(debug) << "Failed to find device for " << device_id << "!";
+      DD_LOG_CATEGORY(platform, debug) << "Failed to find device for " << device_id << "!";
       return {};
     }
 
     const auto display_name {m_w_api->getDisplayName(*path)};
     if (display_name.empty()) {
       // Theoretically possible due to some race condition in the OS...
-      DD_LOG(error) << "Device " << device_id << " has no display name assigned.";
+      DD_LOG_CATEGORY(platform, error) << "Device " << device_id << " has no display name assigned.";
     }
 
     return display_name;
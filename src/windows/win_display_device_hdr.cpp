@@ -25,13 +25,13 @@ namespace display_device {
         [&w_api, &display_data](const auto &device_id, const auto &state, auto &current_state) {
           const auto path {win_utils::getActivePath(w_api, device_id, display_data.m_paths)};
           if (!path) {
-            DD_LOG(error) << "Failed to find device for " << device_id << "!";
+            DD_LOG_CATEGORY(platform, error) << "Failed to find device for " << device_id << "!";
             return false;
           }
 
           const auto current_state_int {w_api.getHdrState(*path)};
           if (!current_state_int) {
-            DD_LOG(error) << "HDR state cannot be changed for " << device_id << "!";
+            DD_LOG_CATEGORY(platform, error) << "HDR state cannot be changed for " << device_id << "!";
             return false;
           }
 
@@ -68,7 +68,7 @@ namespace display_device {
 
   HdrStateMap WinDisplayDevice::getCurrentHdrStates(const std::set<std::string> &device_ids) const {
     if (device_ids.empty()) {
-      DD_LOG(error) << "Device id set is empty!";
+      DD_LOG_CATEGORY(platform, error) << "Device id set is empty!";
       return {};
     }
 
@@ -82,7 +82,7 @@ namespace display_device {
     for (const auto &device_id : device_ids) {
       const auto path {win_utils::getActivePath(*m_w_api, device_id, display_data->m_paths)};
       if (!path) {
-        DD_LOG(error) << "Failed to find device for " << device_id << "!";
+        DD_LOG_CATEGORY(platform, error) << "Failed to find device for " << device_id << "!";
         return {};
       }
 
@@ -94,7 +94,7 @@ namespace display_device {
 
   bool WinDisplayDevice::setHdrStates(const HdrStateMap &states) {
     if (states.empty()) {
-      DD_LOG(error) << "States map is empty!";
+      DD_LOG_CATEGORY(platform, error) << "States map is empty!";
       return false;
     }
 
@@ -28,8 +28,12 @@ void BaseTest::TearDown() {
     return;
   }
 
-  // reset the callback to avoid potential leaks
+  // stop the background writer and reset the callback to avoid potential leaks
+  display_device::Logger::get().disableAsync();
   display_device::Logger::get().setCustomCallback(nullptr);
+  display_device::Logger::get().setRecordCallback(nullptr);
+  display_device::Logger::get().removeAllSinks();
+  display_device::Logger::get().disableFlightRecorder();
 
   // Restore cout buffer and print the suppressed output out in case we have failed :/
   if (isOutputSuppressed()) {
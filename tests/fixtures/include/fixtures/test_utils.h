@@ -1,6 +1,8 @@
 #pragma once
 
 // system includes
+#include <array>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
@@ -13,10 +15,44 @@
  * @note Data is to be extended with relevant information as needed.
  */
 namespace ut_consts {
+  namespace detail {
+    template<typename... Ts>
+    constexpr std::array<std::byte, sizeof...(Ts)> makeByteArray(Ts &&...args) {
+      return {std::byte {static_cast<std::uint8_t>(args)}...};
+    }
+  }  // namespace detail
+
+  // Available in constant expressions, so that the fixture can be verified via static_assert
+  constexpr auto DEFAULT_EDID_BYTES {detail::makeByteArray(
+    // clang-format off
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x69,
+    0xEC, 0x27, 0xAA, 0x55, 0x00, 0x00, 0x13, 0x1D, 0x01, 0x04,
+    0xA5, 0x3C, 0x22, 0x78, 0x06, 0xEE, 0x91, 0xA3, 0x54, 0x4C,
+    0x99, 0x26, 0x0F, 0x50, 0x54, 0x21, 0x08, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x56, 0x5E, 0x00, 0xA0, 0xA0, 0xA0,
+    0x29, 0x50, 0x30, 0x20, 0x35, 0x00, 0x56, 0x50, 0x21, 0x00,
+    0x00, 0x1A, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x23, 0x41, 0x53,
+    0x4E, 0x39, 0x4A, 0x36, 0x6E, 0x4E, 0x49, 0x54, 0x62, 0x64,
+    0x00, 0x00, 0x00, 0xFD, 0x00, 0x1E, 0x90, 0x22, 0xDE, 0x3B,
+    0x01, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x52, 0x4F, 0x47, 0x20, 0x50, 0x47, 0x32,
+    0x37, 0x39, 0x51, 0x0A, 0x20, 0x20, 0x01, 0x8B
+    // clang-format on
+  )};
+
   extern const std::vector<std::byte> DEFAULT_EDID;
   extern const display_device::EdidData DEFAULT_EDID_DATA;
 }  // namespace ut_consts
 
+/**
+ * @brief Append extension blocks to the EDID data, updating the extension count and checksums.
+ * @param base Base EDID block to append the extensions to.
+ * @param extensions Extension block data without the checksum (will be padded with zeros).
+ * @return EDID data with the extension blocks.
+ */
+std::vector<std::byte> makeEdidWithExtensions(std::vector<std::byte> base, const std::vector<std::vector<std::uint8_t>> &extensions);
+
 /**
  * @brief Test regular expression against string.
  * @return True if string matches the regex, false otherwise.
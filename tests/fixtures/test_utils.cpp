@@ -9,31 +9,13 @@
 #include <iostream>
 #include <regex>
 
+// local includes
+#include "display_device/edid.h"
+
 namespace ut_consts {
-  namespace {
-    template<typename... Ts>
-    std::vector<std::byte> makeBytes(Ts &&...args) {
-      return {std::byte {static_cast<std::uint8_t>(args)}...};
-    }
-  }  // namespace
+  static_assert(display_device::EdidView::isBaseBlockValid(DEFAULT_EDID_BYTES), "DEFAULT_EDID_BYTES must have a valid header and checksum!");
 
-  const std::vector<std::byte> DEFAULT_EDID {makeBytes(
-    // clang-format off
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x69,
-    0xEC, 0x27, 0xAA, 0x55, 0x00, 0x00, 0x13, 0x1D, 0x01, 0x04,
-    0xA5, 0x3C, 0x22, 0x78, 0x06, 0xEE, 0x91, 0xA3, 0x54, 0x4C,
-    0x99, 0x26, 0x0F, 0x50, 0x54, 0x21, 0x08, 0x00, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x56, 0x5E, 0x00, 0xA0, 0xA0, 0xA0,
-    0x29, 0x50, 0x30, 0x20, 0x35, 0x00, 0x56, 0x50, 0x21, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x23, 0x41, 0x53,
-    0x4E, 0x39, 0x4A, 0x36, 0x6E, 0x4E, 0x49, 0x54, 0x62, 0x64,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x1E, 0x90, 0x22, 0xDE, 0x3B,
-    0x01, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x52, 0x4F, 0x47, 0x20, 0x50, 0x47, 0x32,
-    0x37, 0x39, 0x51, 0x0A, 0x20, 0x20, 0x01, 0x8B
-    // clang-format on
-  )};
+  const std::vector<std::byte> DEFAULT_EDID {std::begin(DEFAULT_EDID_BYTES), std::end(DEFAULT_EDID_BYTES)};
   const display_device::EdidData DEFAULT_EDID_DATA {
     .m_manufacturer_id = "ACI",
     .m_product_code = "27EC",
@@ -41,6 +23,32 @@ namespace ut_consts {
   };
 }  // namespace ut_consts
 
+std::vector<std::byte> makeEdidWithExtensions(std::vector<std::byte> base, const std::vector<std::vector<std::uint8_t>> &extensions) {
+  constexpr std::size_t block_size {128};
+  const auto update_checksum {[](std::byte *block) {
+    int sum {0};
+    for (std::size_t i = 0; i < block_size - 1; ++i) {
+      sum += static_cast<int>(block[i]);
+    }
+    block[block_size - 1] = std::byte {static_cast<std::uint8_t>((256 - sum % 256) % 256)};
+  }};
+
+  base.resize(block_size);
+  base[126] = std::byte {static_cast<std::uint8_t>(extensions.size())};
+  update_checksum(base.data());
+
+  for (const auto &extension : extensions) {
+    const auto offset {base.size()};
+    base.resize(offset + block_size);
+    for (std::size_t i = 0; i < extension.size() && i < block_size - 1; ++i) {
+      base[offset + i] = std::byte {extension[i]};
+    }
+    update_checksum(base.data() + offset);
+  }
+
+  return base;
+}
+
 bool testRegex(const std::string &input, const std::string &pattern) {
   std::regex regex(pattern);
   std::smatch match;
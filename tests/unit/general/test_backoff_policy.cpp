@@ -0,0 +1,95 @@
+// system includes
+#include <gmock/gmock.h>
+
+// local includes
+#include "display_device/backoff_policy.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  using namespace std::chrono_literals;
+
+  std::vector<std::chrono::milliseconds> takeDurations(display_device::BackoffPolicy policy, const std::size_t count) {
+    std::vector<std::chrono::milliseconds> durations;
+    for (std::size_t i {0}; i < count; ++i) {
+      durations.push_back(display_device::takeNextDuration(policy));
+    }
+    return durations;
+  }
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, BackoffPolicy, __VA_ARGS__)
+}  // namespace
+
+TEST_S(List) {
+  EXPECT_EQ(takeDurations(display_device::ListBackoff {.m_durations = {10ms, 20ms, 30ms}}, 5), (std::vector {10ms, 20ms, 30ms, 30ms, 30ms}));
+  EXPECT_EQ(takeDurations(display_device::ListBackoff {.m_durations = {10ms}}, 2), (std::vector {10ms, 10ms}));
+}
+
+TEST_S(Constant) {
+  EXPECT_EQ(takeDurations(display_device::ConstantBackoff {.m_duration = 15ms}, 3), (std::vector {15ms, 15ms, 15ms}));
+}
+
+TEST_S(Linear) {
+  EXPECT_EQ(takeDurations(display_device::LinearBackoff {.m_initial = 10ms, .m_step = 5ms, .m_max = 22ms}, 5), (std::vector {10ms, 15ms, 20ms, 22ms, 22ms}));
+  EXPECT_EQ(takeDurations(display_device::LinearBackoff {.m_initial = 10ms, .m_step = 0ms}, 3), (std::vector {10ms, 10ms, 10ms}));
+
+  // No overflow with the default maximum
+  display_device::BackoffPolicy policy {display_device::LinearBackoff {.m_initial = 1ms, .m_step = std::chrono::milliseconds::max() / 2}};
+  for (int i {0}; i < 5; ++i) {
+    EXPECT_GT(display_device::takeNextDuration(policy), 0ms);
+  }
+}
+
+TEST_S(Exponential) {
+  EXPECT_EQ(takeDurations(display_device::ExponentialBackoff {.m_initial = 10ms, .m_multiplier = 2.0, .m_max = 100ms}, 6), (std::vector {10ms, 20ms, 40ms, 80ms, 100ms, 100ms}));
+  EXPECT_EQ(takeDurations(display_device::ExponentialBackoff {.m_initial = 10ms, .m_multiplier = 1.5, .m_max = 1s}, 3), (std::vector {10ms, 15ms, 22ms}));
+}
+
+TEST_S(Exponential, SmallDurationsGrow) {
+  EXPECT_EQ(takeDurations(display_device::ExponentialBackoff {.m_initial = 1ms, .m_multiplier = 1.5, .m_max = 1s}, 5), (std::vector {1ms, 2ms, 3ms, 4ms, 6ms}));
+  EXPECT_EQ(takeDurations(display_device::ExponentialBackoff {.m_initial = 2ms, .m_multiplier = 1.25, .m_max = 1s}, 5), (std::vector {2ms, 3ms, 4ms, 5ms, 6ms}));
+  EXPECT_EQ(takeDurations(display_device::ExponentialBackoff {.m_initial = 2ms, .m_multiplier = 1.0, .m_max = 1s}, 3), (std::vector {2ms, 2ms, 2ms}));
+}
+
+TEST_S(DecorrelatedJitter) {
+  display_device::BackoffPolicy policy {display_device::DecorrelatedJitterBackoff {.m_base = 10ms, .m_max = 500ms}};
+  EXPECT_EQ(display_device::takeNextDuration(policy), 10ms);
+
+  auto previous {10ms};
+  for (int i {0}; i < 1000; ++i) {
+    const auto duration {display_device::takeNextDuration(policy)};
+    EXPECT_GE(duration, 10ms);
+    EXPECT_LE(duration, std::min(previous * 3, 500ms));
+    previous = duration;
+  }
+}
+
+TEST_S(DecorrelatedJitter, CopiesAreNotInLockstep) {
+  const display_device::BackoffPolicy policy {display_device::DecorrelatedJitterBackoff {.m_base = 10ms, .m_max = 10s}};
+  EXPECT_NE(takeDurations(policy, 20), takeDurations(policy, 20));
+}
+
+TEST_S(Custom) {
+  display_device::BackoffPolicy policy {display_device::CustomBackoff {.m_function = [](const std::size_t attempt) {
+    return attempt == 0 ? 0ms : std::chrono::milliseconds {attempt * 100};
+  }}};
+  EXPECT_EQ(takeDurations(policy, 3), (std::vector {1ms, 100ms, 200ms}));
+}
+
+TEST_S(Validation) {
+  using namespace display_device;
+  EXPECT_TRUE(isValidBackoffPolicy(ListBackoff {.m_durations = {1ms}}));
+  EXPECT_FALSE(isValidBackoffPolicy(ListBackoff {}));
+  EXPECT_FALSE(isValidBackoffPolicy(ListBackoff {.m_durations = {1ms, 0ms}}));
+  EXPECT_TRUE(isValidBackoffPolicy(ConstantBackoff {.m_duration = 1ms}));
+  EXPECT_FALSE(isValidBackoffPolicy(ConstantBackoff {.m_duration = 0ms}));
+  EXPECT_TRUE(isValidBackoffPolicy(LinearBackoff {.m_initial = 1ms, .m_step = 0ms}));
+  EXPECT_FALSE(isValidBackoffPolicy(LinearBackoff {.m_initial = 1ms, .m_step = -1ms}));
+  EXPECT_FALSE(isValidBackoffPolicy(LinearBackoff {.m_initial = 10ms, .m_step = 1ms, .m_max = 5ms}));
+  EXPECT_TRUE(isValidBackoffPolicy(ExponentialBackoff {.m_initial = 1ms, .m_multiplier = 1.0, .m_max = 1ms}));
+  EXPECT_FALSE(isValidBackoffPolicy(ExponentialBackoff {.m_initial = 1ms, .m_multiplier = 0.5, .m_max = 1s}));
+  EXPECT_FALSE(isValidBackoffPolicy(ExponentialBackoff {.m_initial = 0ms, .m_multiplier = 2.0, .m_max = 1s}));
+  EXPECT_TRUE(isValidBackoffPolicy(DecorrelatedJitterBackoff {.m_base = 1ms, .m_max = 1ms}));
+  EXPECT_FALSE(isValidBackoffPolicy(DecorrelatedJitterBackoff {.m_base = 10ms, .m_max = 1ms}));
+  EXPECT_FALSE(isValidBackoffPolicy(CustomBackoff {}));
+}
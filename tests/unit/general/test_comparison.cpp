@@ -25,6 +25,15 @@ TEST_S(Resolution) {
   EXPECT_NE(display_device::Resolution({1, 1}), display_device::Resolution({1, 0}));
 }
 
+TEST_S(FixedString) {
+  EXPECT_EQ(display_device::FixedString<4>("ABC"), display_device::FixedString<4>(std::string_view {"ABC"}));
+  EXPECT_NE(display_device::FixedString<4>("ABC"), display_device::FixedString<4>("ABCD"));
+  EXPECT_NE(display_device::FixedString<4>("ABC"), display_device::FixedString<4>(""));
+  EXPECT_TRUE(display_device::FixedString<4>().empty());
+  EXPECT_EQ(display_device::FixedString<4>("ABC").view(), "ABC");
+  EXPECT_THROW(display_device::FixedString<4>(std::string_view {"ABCDE"}), std::logic_error);
+}
+
 TEST_S(EdidData) {
   EXPECT_EQ(display_device::EdidData({"LOL", "1337", 1234}), display_device::EdidData({"LOL", "1337", 1234}));
   EXPECT_NE(display_device::EdidData({"LOL", "1337", 1234}), display_device::EdidData({"MEH", "1337", 1234}));
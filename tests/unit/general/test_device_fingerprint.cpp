@@ -0,0 +1,79 @@
+// system includes
+#include <unordered_set>
+
+// local includes
+#include "display_device/device_fingerprint.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords
+  using display_device::DeviceFingerprint;
+
+  // Test constants
+  constexpr std::string_view CONNECTOR_ID {"DISPLAY\\ACI27EC\\5&4FD2DE4UID4352"};
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, DeviceFingerprint, __VA_ARGS__)
+}  // namespace
+
+TEST_S(StableValue) {
+  // Persisted device IDs depend on this value, it must never change!
+  EXPECT_EQ(DeviceFingerprint::create(ut_consts::DEFAULT_EDID, CONNECTOR_ID).toString(), "{26cd56ba-34eb-8342-9032-32bd190a968c}");
+  EXPECT_EQ(DeviceFingerprint::create({}, std::string_view {}).toString(), "{3615ed06-b85f-8aaa-89e4-edb968db7a48}");
+}
+
+TEST_S(Format) {
+  const auto value {DeviceFingerprint::create(ut_consts::DEFAULT_EDID, CONNECTOR_ID)};
+  const auto bytes {value.getBytes()};
+
+  EXPECT_TRUE(testRegex(value.toString(), R"(^\{[0-9a-f]{8}-[0-9a-f]{4}-8[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}\}$)"));
+  EXPECT_EQ(std::to_integer<int>(bytes[6]) >> 4, 8);
+  EXPECT_EQ(std::to_integer<int>(bytes[8]) >> 6, 2);
+}
+
+TEST_S(InputsAffectValue) {
+  const auto value {DeviceFingerprint::create(ut_consts::DEFAULT_EDID, CONNECTOR_ID)};
+  auto edid {ut_consts::DEFAULT_EDID};
+  edid[12] ^= std::byte {0xFF};
+
+  EXPECT_EQ(value, DeviceFingerprint::create(ut_consts::DEFAULT_EDID, std::as_bytes(std::span {CONNECTOR_ID})));
+  EXPECT_NE(value, DeviceFingerprint::create(edid, CONNECTOR_ID));
+  EXPECT_NE(value, DeviceFingerprint::create(ut_consts::DEFAULT_EDID, CONNECTOR_ID.substr(1)));
+  EXPECT_NE(value, DeviceFingerprint::create({}, CONNECTOR_ID));
+  EXPECT_NE(value, DeviceFingerprint::create(ut_consts::DEFAULT_EDID, std::string_view {}));
+}
+
+TEST_S(InputBoundary) {
+  const std::vector<std::byte> first {std::byte {0x01}, std::byte {0x02}};
+  const std::vector<std::byte> second {std::byte {0x01}};
+
+  EXPECT_NE(DeviceFingerprint::create(first, "\x03"), DeviceFingerprint::create(second, "\x02\x03"));
+  EXPECT_NE(DeviceFingerprint::create(first, std::string_view {}), DeviceFingerprint::create({}, "\x01\x02"));
+}
+
+TEST_S(CollisionCorpus) {
+  // Mimics a large fleet of identical monitor models, that differ only by a serial number
+  // and are connected to one of the many ports
+  std::unordered_set<std::string> ids;
+  std::size_t count {0};
+
+  auto edid {ut_consts::DEFAULT_EDID};
+  for (std::uint32_t serial {0}; serial < 5000; ++serial) {
+    edid[12] = static_cast<std::byte>(serial);
+    edid[13] = static_cast<std::byte>(serial >> 8);
+
+    for (int port {0}; port < 8; ++port) {
+      const std::string connector_id {"DISPLAY\\ACI27EC\\5&4FD2DE4UID" + std::to_string(4352 + port)};
+      ids.insert(DeviceFingerprint::create(edid, connector_id).toString());
+      ++count;
+    }
+  }
+
+  // Identical EDID, but different connectors (e.g. cheap monitors without a serial number)
+  for (int port {0}; port < 10000; ++port) {
+    ids.insert(DeviceFingerprint::create(ut_consts::DEFAULT_EDID, "PORT" + std::to_string(port)).toString());
+    ++count;
+  }
+
+  EXPECT_EQ(ids.size(), count);
+}
@@ -0,0 +1,175 @@
+// system includes
+#include <algorithm>
+
+// local includes
+#include "display_device/displayid.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords
+  using display_device::DisplayIdDetailedTiming;
+  using display_device::DisplayIdEnumeratedTiming;
+  using display_device::DisplayIdTiledTopology;
+  using display_device::DisplayIdView;
+  using display_device::EdidView;
+
+  // Test constants
+  const std::vector<std::uint8_t> DATA_BLOCKS {
+    // clang-format off
+    // Type VII timing, 3840x4320@60 (preferred)
+    0x22, 0x00, 0x14,
+    0x3F, 0x46, 0x10, 0x88, 0xFF, 0x0E, 0x9F, 0x00, 0x2F, 0x80, 0x1F, 0x00, 0xDF, 0x10, 0x7B, 0x00, 0x02, 0x00, 0x04, 0x00,
+    // Type VIII timing codes, 1-byte VICs
+    0x23, 0x40, 0x02, 0x10, 0x61,
+    // Type VIII timing codes, 2-byte DMT IDs
+    0x23, 0x08, 0x04, 0x52, 0x00, 0x55, 0x00,
+    // Tiled display topology, right tile of 2x1 tiled display
+    0x28, 0x00, 0x16,
+    0x80, 0x10, 0x10, 0x00, 0xFF, 0x0E, 0xDF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x34, 0x56, 0x34, 0x12, 0x78, 0x56, 0x34, 0x12,
+    // Unknown block
+    0x7E, 0x00, 0x01, 0xAA
+    // clang-format on
+  };
+  const DisplayIdDetailedTiming TILE_TIMING {{1066560, 3840, 160, 48, 32, 4320, 124, 3, 5, false}, true, 8};
+  const DisplayIdTiledTopology TILE_TOPOLOGY {true, 2, 1, 1, 0, {3840, 4320}, 0x123456, 0x1234, 0x12345678};
+
+  /**
+   * @brief Make EDID extension block with the DisplayID section.
+   */
+  std::vector<std::uint8_t> makeDisplayIdBlock(const std::vector<std::uint8_t> &data_blocks, const std::uint8_t version = 0x20) {
+    constexpr std::size_t header_size {5};
+    std::vector<std::uint8_t> block(header_size + data_blocks.size());
+    block[0] = DisplayIdView::EXTENSION_TAG;
+    block[1] = version;
+    block[2] = static_cast<std::uint8_t>(data_blocks.size());
+    block[3] = 0x03;
+    std::ranges::copy(data_blocks, std::begin(block) + header_size);
+
+    std::uint8_t sum {0};
+    for (std::size_t i {1}; i < block.size(); ++i) {
+      sum = static_cast<std::uint8_t>(sum + block[i]);
+    }
+    block.push_back(static_cast<std::uint8_t>(0x100 - sum));
+    return block;
+  }
+
+  std::vector<std::byte> toBlock(const std::vector<std::uint8_t> &data) {
+    const auto edid {makeEdidWithExtensions(ut_consts::DEFAULT_EDID, {data})};
+    return {std::begin(edid) + EdidView::BLOCK_SIZE, std::end(edid)};
+  }
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, DisplayIdView, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Create) {
+  const auto block {toBlock(makeDisplayIdBlock(DATA_BLOCKS))};
+  const auto view {DisplayIdView::create(block)};
+
+  ASSERT_TRUE(view);
+  EXPECT_EQ(view->getRevision(), 0);
+  EXPECT_EQ(view->getProductType(), 3);
+}
+
+TEST_S(Create, InvalidData) {
+  const auto valid_block {toBlock(makeDisplayIdBlock(DATA_BLOCKS))};
+  auto bad_checksum {valid_block};
+  bad_checksum[10] = std::byte {0x00};
+
+  auto bad_size {makeDisplayIdBlock({})};
+  bad_size[2] = 0x7A;
+
+  EXPECT_EQ(DisplayIdView::create({}), std::nullopt);
+  EXPECT_EQ(DisplayIdView::create(std::span {valid_block}.first(127)), std::nullopt);
+  EXPECT_EQ(DisplayIdView::create(toBlock({0x02, 0x03, 0x04, 0x00})), std::nullopt);
+  EXPECT_EQ(DisplayIdView::create(toBlock(makeDisplayIdBlock(DATA_BLOCKS, 0x12))), std::nullopt);
+  EXPECT_EQ(DisplayIdView::create(toBlock(bad_size)), std::nullopt);
+  EXPECT_EQ(DisplayIdView::create(bad_checksum), std::nullopt);
+}
+
+TEST_S(ForEachInEdid) {
+  const auto edid {makeEdidWithExtensions(ut_consts::DEFAULT_EDID, {{0x02, 0x03, 0x04, 0x00}, makeDisplayIdBlock(DATA_BLOCKS), makeDisplayIdBlock({})})};
+  const auto edid_view {EdidView::create(edid)};
+  ASSERT_TRUE(edid_view);
+
+  std::vector<std::optional<DisplayIdTiledTopology>> topologies;
+  DisplayIdView::forEachInEdid(*edid_view, [&topologies](const DisplayIdView &view) {
+    topologies.push_back(view.getTiledTopology());
+  });
+
+  EXPECT_EQ(topologies, (std::vector<std::optional<DisplayIdTiledTopology>> {TILE_TOPOLOGY, std::nullopt}));
+}
+
+TEST_S(ForEachDataBlock) {
+  auto data_blocks {DATA_BLOCKS};
+  data_blocks.insert(std::end(data_blocks), {0x00, 0x00, 0x00, 0x22, 0x00, 0x00});  // Padding, followed by garbage
+  const auto block {toBlock(makeDisplayIdBlock(data_blocks))};
+  const auto view {DisplayIdView::create(block)};
+  ASSERT_TRUE(view);
+
+  std::vector<std::pair<std::uint8_t, std::size_t>> data_block_info;
+  view->forEachDataBlock([&data_block_info](const std::uint8_t tag, std::uint8_t, const std::span<const std::byte> payload) {
+    data_block_info.emplace_back(tag, payload.size());
+  });
+
+  EXPECT_EQ(data_block_info, (std::vector<std::pair<std::uint8_t, std::size_t>> {{0x22, 20}, {0x23, 2}, {0x23, 4}, {0x28, 22}, {0x7E, 1}}));
+}
+
+TEST_S(ForEachDataBlock, TruncatedBlock) {
+  const auto block {toBlock(makeDisplayIdBlock({0x23, 0x40, 0x01, 0x10, 0x23, 0x40, 0x05, 0x10}))};
+  const auto view {DisplayIdView::create(block)};
+  ASSERT_TRUE(view);
+
+  std::size_t count {0};
+  view->forEachDataBlock([&count](std::uint8_t, std::uint8_t, std::span<const std::byte>) {
+    ++count;
+  });
+  EXPECT_EQ(count, 1);
+}
+
+TEST_S(ForEachDetailedTiming) {
+  const auto block {toBlock(makeDisplayIdBlock(DATA_BLOCKS))};
+  const auto view {DisplayIdView::create(block)};
+  ASSERT_TRUE(view);
+
+  std::vector<DisplayIdDetailedTiming> timings;
+  view->forEachDetailedTiming([&timings](const DisplayIdDetailedTiming &timing) {
+    timings.push_back(timing);
+  });
+
+  ASSERT_EQ(timings, std::vector {TILE_TIMING});
+  EXPECT_EQ(timings[0].m_timing.getRefreshRate(), (display_device::Rational {1066560000, 4000 * 4444}));
+}
+
+TEST_S(ForEachEnumeratedTiming) {
+  using enum DisplayIdEnumeratedTiming::CodeType;
+
+  const auto block {toBlock(makeDisplayIdBlock(DATA_BLOCKS))};
+  const auto view {DisplayIdView::create(block)};
+  ASSERT_TRUE(view);
+
+  std::vector<DisplayIdEnumeratedTiming> timings;
+  view->forEachEnumeratedTiming([&timings](const DisplayIdEnumeratedTiming &timing) {
+    timings.push_back(timing);
+  });
+
+  EXPECT_EQ(timings, (std::vector<DisplayIdEnumeratedTiming> {{Vic, 16}, {Vic, 97}, {Dmt, 0x52}, {Dmt, 0x55}}));
+}
+
+TEST_S(DecodeTiledTopology) {
+  std::vector<std::byte> payload(22);
+  payload[1] = std::byte {0xFF};
+  payload[2] = std::byte {0xEF};
+  payload[3] = std::byte {0xFE};
+
+  const auto topology {DisplayIdView::decodeTiledTopology(payload)};
+  ASSERT_TRUE(topology);
+  EXPECT_FALSE(topology->m_single_enclosure);
+  EXPECT_EQ(topology->m_horizontal_tiles, 64);
+  EXPECT_EQ(topology->m_vertical_tiles, 64);
+  EXPECT_EQ(topology->m_horizontal_location, 62);
+  EXPECT_EQ(topology->m_vertical_location, 47);
+  EXPECT_EQ(topology->m_tile_resolution, (display_device::Resolution {1, 1}));
+
+  EXPECT_EQ(DisplayIdView::decodeTiledTopology(std::span {payload}.first(21)), std::nullopt);
+}
@@ -0,0 +1,174 @@
+// local includes
+#include "display_device/edid.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords
+  using display_device::EdidAudioDescriptor;
+  using display_device::EdidDetailedTiming;
+  using display_device::EdidHdrStaticMetadata;
+  using display_device::EdidVideoDescriptor;
+  using display_device::EdidView;
+
+  // Test constants
+  const std::vector<std::uint8_t> CTA_EXTENSION {
+    // clang-format off
+    0x02, 0x03, 0x14, 0xF1,
+    // Video data block (VIC 16 native, VIC 4, VIC 3, reserved value)
+    0x44, 0x90, 0x04, 0x03, 0x80,
+    // Audio data block (LPCM, 2 channels)
+    0x23, 0x09, 0x07, 0x07,
+    // HDR static metadata data block (SDR, PQ, HLG)
+    0xE6, 0x06, 0x0D, 0x01, 0x78, 0x5A, 0x20,
+    // 1920x1080@60 detailed timing descriptor
+    0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00, 0x0F, 0x28, 0x21, 0x00, 0x00, 0x1E
+    // clang-format on
+  };
+  const EdidDetailedTiming BASE_TIMING {241500, 2560, 160, 48, 32, 1440, 41, 3, 5, false};
+  const EdidDetailedTiming CTA_TIMING {148500, 1920, 280, 88, 44, 1080, 45, 4, 5, false};
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, EdidView, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Create, InvalidData) {
+  auto EDID_DATA {ut_consts::DEFAULT_EDID};
+  EDID_DATA[16] = std::byte {0x00};
+
+  EXPECT_EQ(EdidView::create({}), std::nullopt);
+  EXPECT_EQ(EdidView::create(std::span {ut_consts::DEFAULT_EDID}.first(127)), std::nullopt);
+  EXPECT_EQ(EdidView::create(EDID_DATA), std::nullopt);
+}
+
+TEST_S(Create, MissingExtensionBlocks) {
+  // The default EDID declares 1 extension block, but does not have it
+  const auto view {EdidView::create(ut_consts::DEFAULT_EDID)};
+  ASSERT_TRUE(view);
+  EXPECT_EQ(view->getBlockCount(), 1);
+  EXPECT_TRUE(view->getBlock(1).empty());
+  EXPECT_FALSE(view->isBlockValid(1));
+}
+
+TEST_S(Create, TrailingDataIgnored) {
+  auto EDID_DATA {makeEdidWithExtensions(ut_consts::DEFAULT_EDID, {CTA_EXTENSION})};
+  EDID_DATA.resize(EDID_DATA.size() + 200);
+
+  const auto view {EdidView::create(EDID_DATA)};
+  ASSERT_TRUE(view);
+  EXPECT_EQ(view->getBlockCount(), 2);
+  EXPECT_TRUE(view->isBlockValid(1));
+}
+
+TEST_S(BaseFields) {
+  const auto view {EdidView::create(ut_consts::DEFAULT_EDID)};
+  ASSERT_TRUE(view);
+  EXPECT_EQ(view->getManufacturerId(), (std::array {'A', 'C', 'I'}));
+  EXPECT_EQ(view->getProductCode(), 0x27EC);
+  EXPECT_EQ(view->getSerialNumber(), 21930);
+}
+
+TEST_S(PreferredTiming) {
+  const auto view {EdidView::create(ut_consts::DEFAULT_EDID)};
+  ASSERT_TRUE(view);
+
+  const auto timing {view->getPreferredTiming()};
+  EXPECT_EQ(timing, BASE_TIMING);
+  EXPECT_EQ(timing->getRefreshRate(), display_device::Rational({241500000, 2720 * 1481}));
+}
+
+TEST_S(DetailedTimings) {
+  const auto EDID_DATA {makeEdidWithExtensions(ut_consts::DEFAULT_EDID, {CTA_EXTENSION})};
+  const auto view {EdidView::create(EDID_DATA)};
+  ASSERT_TRUE(view);
+
+  std::vector<EdidDetailedTiming> timings;
+  view->forEachDetailedTiming([&timings](const EdidDetailedTiming &timing) {
+    timings.push_back(timing);
+  });
+  EXPECT_EQ(timings, (std::vector {BASE_TIMING, CTA_TIMING}));
+  EXPECT_EQ(CTA_TIMING.getRefreshRate(), display_device::Rational({148500000, 2200 * 1125}));
+}
+
+TEST_S(VideoDescriptors) {
+  const auto EDID_DATA {makeEdidWithExtensions(ut_consts::DEFAULT_EDID, {CTA_EXTENSION})};
+  const auto view {EdidView::create(EDID_DATA)};
+  ASSERT_TRUE(view);
+
+  std::vector<EdidVideoDescriptor> descriptors;
+  view->forEachVideoDescriptor([&descriptors](const EdidVideoDescriptor &descriptor) {
+    descriptors.push_back(descriptor);
+  });
+  EXPECT_EQ(descriptors, (std::vector<EdidVideoDescriptor> {{16, true}, {4, false}, {3, false}}));
+}
+
+TEST_S(AudioDescriptors) {
+  const auto EDID_DATA {makeEdidWithExtensions(ut_consts::DEFAULT_EDID, {CTA_EXTENSION})};
+  const auto view {EdidView::create(EDID_DATA)};
+  ASSERT_TRUE(view);
+
+  std::vector<EdidAudioDescriptor> descriptors;
+  view->forEachAudioDescriptor([&descriptors](const EdidAudioDescriptor &descriptor) {
+    descriptors.push_back(descriptor);
+  });
+  EXPECT_EQ(descriptors, (std::vector<EdidAudioDescriptor> {{1, 2, 0x07, 0x07}}));
+}
+
+TEST_S(HdrStaticMetadata) {
+  const auto EDID_DATA {makeEdidWithExtensions(ut_consts::DEFAULT_EDID, {CTA_EXTENSION})};
+  const auto view {EdidView::create(EDID_DATA)};
+  ASSERT_TRUE(view);
+
+  const auto metadata {view->getHdrStaticMetadata()};
+  EXPECT_EQ(metadata, (EdidHdrStaticMetadata {0x0D, 0x01, 0x78, 0x5A, 0x20}));
+  EXPECT_TRUE(metadata->isEotfSupported(EdidHdrStaticMetadata::Eotf::TraditionalSdr));
+  EXPECT_FALSE(metadata->isEotfSupported(EdidHdrStaticMetadata::Eotf::TraditionalHdr));
+  EXPECT_TRUE(metadata->isEotfSupported(EdidHdrStaticMetadata::Eotf::SmpteSt2084));
+  EXPECT_TRUE(metadata->isEotfSupported(EdidHdrStaticMetadata::Eotf::Hlg));
+}
+
+TEST_S(HdrStaticMetadata, NotAvailable) {
+  const auto view {EdidView::create(ut_consts::DEFAULT_EDID)};
+  ASSERT_TRUE(view);
+  EXPECT_EQ(view->getHdrStaticMetadata(), std::nullopt);
+}
+
+TEST_S(InvalidExtensionSkipped) {
+  auto EDID_DATA {makeEdidWithExtensions(ut_consts::DEFAULT_EDID, {CTA_EXTENSION})};
+  EDID_DATA[EdidView::BLOCK_SIZE + 5] = std::byte {0x91};
+
+  const auto view {EdidView::create(EDID_DATA)};
+  ASSERT_TRUE(view);
+  EXPECT_FALSE(view->isBlockValid(1));
+
+  int count {0};
+  view->forEachCtaDataBlock([&count](auto, auto) {
+    count++;
+  });
+  EXPECT_EQ(count, 0);
+  EXPECT_EQ(view->getHdrStaticMetadata(), std::nullopt);
+}
+
+TEST_S(ConstantEvaluation) {
+  constexpr auto EDID_DATA {ut_consts::DEFAULT_EDID_BYTES};
+  static_assert(EdidView::isBaseBlockValid(EDID_DATA));
+  static_assert(EdidView::decodeManufacturerId(EDID_DATA) == std::array {'A', 'C', 'I'});
+  static_assert(EdidView::isManufacturerIdValid(EdidView::decodeManufacturerId(EDID_DATA)));
+  static_assert(EdidView::formatProductCode(EdidView::decodeProductCode(EDID_DATA)) == std::array {'2', '7', 'E', 'C'});
+  static_assert(EdidView::decodeSerialNumber(EDID_DATA) == 21930);
+
+  static_assert(![]() {
+    auto data {ut_consts::DEFAULT_EDID_BYTES};
+    data[1] = std::byte {0xAA};
+    return EdidView::hasFixedHeader(data);
+  }());
+  static_assert(![]() {
+    auto data {ut_consts::DEFAULT_EDID_BYTES};
+    data[16] = std::byte {0x00};
+    return EdidView::isBaseBlockValid(data);
+  }());
+  static_assert(!EdidView::isManufacturerIdValid({'A', '@', 'C'}));
+
+  // Runtime evaluation must produce the same results
+  EXPECT_TRUE(EdidView::isBaseBlockValid(ut_consts::DEFAULT_EDID));
+  EXPECT_EQ(EdidView::formatProductCode(0x0A0F), (std::array {'0', 'A', '0', 'F'}));
+}
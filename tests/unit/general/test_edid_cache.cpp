@@ -0,0 +1,126 @@
+// system includes
+#include <gmock/gmock.h>
+#include <thread>
+
+// local includes
+#include "display_device/edid_cache.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Test fixture(s) for this file
+  class EdidCacheTest: public BaseTest {
+  public:
+    display_device::EdidCache m_impl {2};
+  };
+
+  std::vector<std::byte> makeEdidWithSerial(const std::uint8_t serial) {
+    auto data {ut_consts::DEFAULT_EDID};
+    data[12] = std::byte {serial};
+    // Fix up the checksum
+    data[127] = std::byte {static_cast<std::uint8_t>(static_cast<int>(data[127]) + static_cast<int>(ut_consts::DEFAULT_EDID[12]) - serial)};
+    return data;
+  }
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, EdidCacheTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(ZeroCapacity) {
+  EXPECT_THAT([]() {
+    const display_device::EdidCache cache {0};
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Zero capacity provided for EdidCache!")));
+}
+
+TEST_F_S(HitAndMiss) {
+  const auto first {m_impl.parse(ut_consts::DEFAULT_EDID)};
+  const auto second {m_impl.parse(ut_consts::DEFAULT_EDID)};
+
+  ASSERT_TRUE(first);
+  EXPECT_EQ(*first, ut_consts::DEFAULT_EDID_DATA);
+  EXPECT_EQ(first, second);  // Same interned instance
+
+  const auto stats {m_impl.getStats()};
+  EXPECT_EQ(stats.m_hits, 1);
+  EXPECT_EQ(stats.m_misses, 1);
+  EXPECT_EQ(stats.m_evictions, 0);
+  EXPECT_EQ(stats.m_size, 1);
+}
+
+TEST_F_S(InvalidDataCached) {
+  const std::vector<std::byte> EDID_DATA {std::byte {0x11}};
+
+  EXPECT_EQ(m_impl.parse(EDID_DATA), nullptr);
+  EXPECT_EQ(m_impl.parse(EDID_DATA), nullptr);
+  EXPECT_EQ(m_impl.parse({}), nullptr);
+
+  const auto stats {m_impl.getStats()};
+  EXPECT_EQ(stats.m_hits, 1);
+  EXPECT_EQ(stats.m_misses, 2);
+  EXPECT_EQ(stats.m_size, 2);
+}
+
+TEST_F_S(LeastRecentlyUsedEviction) {
+  const auto EDID_A {makeEdidWithSerial(1)};
+  const auto EDID_B {makeEdidWithSerial(2)};
+  const auto EDID_C {makeEdidWithSerial(3)};
+
+  const auto edid_a {m_impl.parse(EDID_A)};
+  const auto edid_b {m_impl.parse(EDID_B)};
+  ASSERT_TRUE(edid_a);
+  ASSERT_TRUE(edid_b);
+  EXPECT_EQ(edid_a->m_serial_number, (ut_consts::DEFAULT_EDID_DATA.m_serial_number & 0xFFFFFF00u) | 1u);
+
+  // Touch A, so that B is evicted instead
+  EXPECT_EQ(m_impl.parse(EDID_A), edid_a);
+  EXPECT_TRUE(m_impl.parse(EDID_C));
+
+  auto stats {m_impl.getStats()};
+  EXPECT_EQ(stats.m_evictions, 1);
+  EXPECT_EQ(stats.m_size, 2);
+
+  EXPECT_EQ(m_impl.parse(EDID_A), edid_a);
+  EXPECT_NE(m_impl.parse(EDID_B), edid_b);  // Parsed again
+
+  stats = m_impl.getStats();
+  EXPECT_EQ(stats.m_hits, 2);
+  EXPECT_EQ(stats.m_misses, 4);
+}
+
+TEST_F_S(Clear) {
+  const auto edid {m_impl.parse(ut_consts::DEFAULT_EDID)};
+  m_impl.clear();
+  EXPECT_EQ(m_impl.getStats().m_size, 0);
+
+  // Previously returned data is still alive and equal
+  const auto new_edid {m_impl.parse(ut_consts::DEFAULT_EDID)};
+  EXPECT_NE(edid, new_edid);
+  EXPECT_EQ(*edid, *new_edid);
+}
+
+TEST_F_S(ConcurrentAccess) {
+  display_device::EdidCache cache;
+  std::vector<std::thread> threads;
+  for (int i {0}; i < 4; ++i) {
+    threads.emplace_back([&cache]() {
+      for (int j {0}; j < 100; ++j) {
+        EXPECT_EQ(*cache.parse(ut_consts::DEFAULT_EDID), ut_consts::DEFAULT_EDID_DATA);
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  const auto stats {cache.getStats()};
+  EXPECT_EQ(stats.m_hits + stats.m_misses, 400);
+  EXPECT_EQ(stats.m_size, 1);
+}
+
+TEST_F_S(ProcessWideInstance) {
+  EXPECT_EQ(&display_device::EdidCache::get(), &display_device::EdidCache::get());
+}
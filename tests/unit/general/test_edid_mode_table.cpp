@@ -0,0 +1,124 @@
+// local includes
+#include "display_device/edid_mode_table.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords
+  using display_device::EdidMode;
+  using display_device::EdidModeTable;
+  using display_device::EdidView;
+  using display_device::Rational;
+
+  // Test constants
+  const std::vector<std::uint8_t> CTA_EXTENSION {
+    // clang-format off
+    0x02, 0x03, 0x04, 0xF1,
+    // 1920x1080@60 detailed timing descriptor
+    0x02, 0x3A, 0x80, 0x18, 0x71, 0x38, 0x2D, 0x40, 0x58, 0x2C, 0x45, 0x00, 0x0F, 0x28, 0x21, 0x00, 0x00, 0x1E,
+    // 1920x1080i@60 detailed timing descriptor
+    0x01, 0x1D, 0x80, 0x18, 0x71, 0x1C, 0x16, 0x20, 0x58, 0x2C, 0x25, 0x00, 0x0F, 0x28, 0x21, 0x00, 0x00, 0x9E
+    // clang-format on
+  };
+  const Rational BASE_TIMING_REFRESH_RATE {241500000, 2720 * 1481};
+  const Rational CTA_TIMING_REFRESH_RATE {148500000, 2200 * 1125};
+
+  /**
+   * @brief Make EDID with the provided established and standard timings.
+   */
+  std::vector<std::byte> makeEdid(const std::array<std::uint8_t, 3> &established_timings, const std::vector<std::pair<std::uint8_t, std::uint8_t>> &standard_timings) {
+    auto data {ut_consts::DEFAULT_EDID};
+    for (std::size_t i {0}; i < established_timings.size(); ++i) {
+      data[35 + i] = std::byte {established_timings[i]};
+    }
+
+    for (std::size_t i {0}; i < 8; ++i) {
+      const auto timing {i < standard_timings.size() ? standard_timings[i] : std::make_pair<std::uint8_t, std::uint8_t>(0x01, 0x01)};
+      data[38 + i * 2] = std::byte {timing.first};
+      data[38 + i * 2 + 1] = std::byte {timing.second};
+    }
+
+    return makeEdidWithExtensions(data, {CTA_EXTENSION});
+  }
+
+  EdidModeTable makeTable(const std::vector<std::byte> &data) {
+    const auto view {EdidView::create(data)};
+    EXPECT_TRUE(view);
+    return EdidModeTable::create(*view);
+  }
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, EdidModeTable, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Create) {
+  // 640x480@60, 800x600@60, 1024x768@87i (ignored), 1024x768@60, 1152x870@75
+  // 1920x1080@60 and 1920x1080@120 (16:9), 1280x1024@75 (5:4), 1680x1050@60 (16:10)
+  const auto table {makeTable(makeEdid({0x21, 0x18, 0x80}, {{0xD1, 0xC0}, {0xD1, 0xFC}, {0x81, 0x8F}, {0xB3, 0x00}}))};
+
+  const std::vector<EdidMode> expected_modes {
+    {{640, 480}, {60, 1}},
+    {{800, 600}, {60, 1}},
+    {{1024, 768}, {60, 1}},
+    {{1152, 870}, {75, 1}},
+    {{1280, 1024}, {75, 1}},
+    {{1680, 1050}, {60, 1}},
+    {{1920, 1080}, CTA_TIMING_REFRESH_RATE},  // Precise rate of the detailed timing replaces the standard one
+    {{1920, 1080}, {120, 1}},
+    {{2560, 1440}, BASE_TIMING_REFRESH_RATE},
+  };
+  EXPECT_EQ(table.getModes(), expected_modes);
+}
+
+TEST_S(Create, NoModes) {
+  auto data {makeEdid({0x00, 0x00, 0x00}, {})};
+  data.resize(EdidView::BLOCK_SIZE);
+  data[54] = std::byte {0x00};
+  data[55] = std::byte {0x00};
+
+  const auto table {makeTable(makeEdidWithExtensions(data, {}))};
+  EXPECT_TRUE(table.getModes().empty());
+  EXPECT_EQ(table.findClosestMode({1920, 1080}, std::nullopt), std::nullopt);
+}
+
+TEST_S(Create, LegacyAspectRatio) {
+  auto data {makeEdid({0x00, 0x00, 0x00}, {{0x81, 0x00}})};
+  data[19] = std::byte {0x02};
+
+  const auto table {makeTable(makeEdidWithExtensions({std::begin(data), std::begin(data) + EdidView::BLOCK_SIZE}, {CTA_EXTENSION}))};
+  EXPECT_EQ(table.getModes().front(), (EdidMode {{1280, 1280}, {60, 1}}));
+}
+
+TEST_S(FindClosestMode) {
+  const auto table {makeTable(makeEdid({0x21, 0x18, 0x80}, {{0xD1, 0xC0}, {0xD1, 0xFC}, {0x81, 0x8F}, {0xB3, 0x00}}))};
+
+  // Exact matches
+  EXPECT_EQ(table.findClosestMode({1920, 1080}, Rational {60, 1}), (EdidMode {{1920, 1080}, CTA_TIMING_REFRESH_RATE}));
+  EXPECT_EQ(table.findClosestMode({640, 480}, 60.), (EdidMode {{640, 480}, {60, 1}}));
+
+  // Closest refresh rate
+  EXPECT_EQ(table.findClosestMode({1920, 1080}, 100.), (EdidMode {{1920, 1080}, {120, 1}}));
+  EXPECT_EQ(table.findClosestMode({1920, 1080}, 80.), (EdidMode {{1920, 1080}, CTA_TIMING_REFRESH_RATE}));
+  EXPECT_EQ(table.findClosestMode({1920, 1080}, 240.), (EdidMode {{1920, 1080}, {120, 1}}));
+  EXPECT_EQ(table.findClosestMode({1920, 1080}, 30.), (EdidMode {{1920, 1080}, CTA_TIMING_REFRESH_RATE}));
+
+  // Highest refresh rate if not specified
+  EXPECT_EQ(table.findClosestMode({1920, 1080}, std::nullopt), (EdidMode {{1920, 1080}, {120, 1}}));
+
+  // Closest resolution
+  EXPECT_EQ(table.findClosestMode({1920, 1200}, 60.), (EdidMode {{1920, 1080}, CTA_TIMING_REFRESH_RATE}));
+  EXPECT_EQ(table.findClosestMode({320, 200}, 60.), (EdidMode {{640, 480}, {60, 1}}));
+  EXPECT_EQ(table.findClosestMode({3840, 2160}, 60.), (EdidMode {{2560, 1440}, BASE_TIMING_REFRESH_RATE}));
+}
+
+TEST_S(FindClosestMode, Configuration) {
+  const auto table {makeTable(makeEdid({0x21, 0x18, 0x80}, {{0xD1, 0xC0}, {0xD1, 0xFC}, {0x81, 0x8F}, {0xB3, 0x00}}))};
+
+  display_device::SingleDisplayConfiguration config {};
+  EXPECT_EQ(table.findClosestMode(config, {1024, 768}), (EdidMode {{1024, 768}, {60, 1}}));
+
+  config.m_resolution = {1920, 1080};
+  EXPECT_EQ(table.findClosestMode(config, {1024, 768}), (EdidMode {{1920, 1080}, {120, 1}}));
+
+  config.m_refresh_rate = Rational {6000, 100};
+  EXPECT_EQ(table.findClosestMode(config, {1024, 768}), (EdidMode {{1920, 1080}, CTA_TIMING_REFRESH_RATE}));
+}
@@ -0,0 +1,108 @@
+// local includes
+#include "display_device/edid_stream_parser.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords
+  using display_device::EdidStreamParser;
+  using display_device::EdidView;
+  using enum EdidStreamParser::Status;
+
+  // Test constants
+  const std::vector<std::uint8_t> CTA_EXTENSION {0x02, 0x03, 0x04, 0x00};
+
+  // Test fixture(s) for this file
+  class EdidStreamParserTest: public BaseTest {
+  public:
+    std::vector<std::byte> m_edid {makeEdidWithExtensions(ut_consts::DEFAULT_EDID, {CTA_EXTENSION, CTA_EXTENSION})};
+    std::span<const std::byte> m_data {m_edid};
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, EdidStreamParserTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(BlockAtATime) {
+  EdidStreamParser parser;
+  EXPECT_EQ(parser.getStatus(), NeedMoreData);
+  EXPECT_EQ(parser.getBlocksNeeded(), 1);
+  EXPECT_EQ(parser.getEdidData(), std::nullopt);
+  EXPECT_EQ(parser.getView(), std::nullopt);
+
+  EXPECT_EQ(parser.feed(m_data.first(EdidView::BLOCK_SIZE)), NeedMoreData);
+  EXPECT_EQ(parser.getBlocksNeeded(), 2);
+  EXPECT_EQ(parser.getEdidData(), ut_consts::DEFAULT_EDID_DATA);
+
+  EXPECT_EQ(parser.feed(m_data.subspan(EdidView::BLOCK_SIZE, EdidView::BLOCK_SIZE)), NeedMoreData);
+  EXPECT_EQ(parser.getBlocksNeeded(), 1);
+  EXPECT_EQ(parser.getView()->getBlockCount(), 2);
+
+  EXPECT_EQ(parser.feed(m_data.subspan(EdidView::BLOCK_SIZE * 2)), Complete);
+  EXPECT_EQ(parser.getBlocksNeeded(), 0);
+  EXPECT_EQ(parser.getView()->getBlockCount(), 3);
+  EXPECT_TRUE(parser.getView()->isBlockValid(2));
+}
+
+TEST_F_S(UnalignedChunks) {
+  EdidStreamParser parser;
+  for (std::size_t offset {0}; offset < m_data.size(); offset += 100) {
+    EXPECT_EQ(parser.getStatus(), NeedMoreData);
+    parser.feed(m_data.subspan(offset, std::min<std::size_t>(100, m_data.size() - offset)));
+  }
+
+  EXPECT_EQ(parser.getStatus(), Complete);
+  EXPECT_EQ(parser.getEdidData(), ut_consts::DEFAULT_EDID_DATA);
+  EXPECT_EQ(parser.getView()->getBlockCount(), 3);
+}
+
+TEST_F_S(AllAtOnce, TrailingDataIgnored) {
+  auto data {m_edid};
+  data.resize(data.size() + 50);
+
+  EdidStreamParser parser;
+  EXPECT_EQ(parser.feed(data), Complete);
+  EXPECT_EQ(parser.getView()->getBlockCount(), 3);
+  EXPECT_EQ(parser.feed(data), Complete);
+}
+
+TEST_F_S(BaseBlockScope) {
+  EdidStreamParser parser {EdidStreamParser::Scope::BaseBlock};
+  EXPECT_EQ(parser.feed(m_data.first(64)), NeedMoreData);
+  EXPECT_EQ(parser.getBlocksNeeded(), 1);
+  EXPECT_EQ(parser.feed(m_data.subspan(64, 100)), Complete);
+  EXPECT_EQ(parser.getBlocksNeeded(), 0);
+  EXPECT_EQ(parser.getEdidData(), ut_consts::DEFAULT_EDID_DATA);
+  EXPECT_EQ(parser.getView()->getBlockCount(), 1);
+}
+
+TEST_F_S(InvalidBaseBlock) {
+  auto bad_header {m_edid};
+  bad_header[1] = std::byte {0xAA};
+
+  auto bad_checksum {m_edid};
+  bad_checksum[16] = std::byte {0x00};
+
+  auto bad_manufacturer {m_edid};
+  bad_manufacturer[8] = std::byte {0x00};
+  bad_manufacturer[9] = std::byte {0x6D};
+
+  for (const auto &data : {bad_header, bad_checksum, bad_manufacturer}) {
+    EdidStreamParser parser;
+    EXPECT_EQ(parser.feed(data), Failed);
+    EXPECT_EQ(parser.getBlocksNeeded(), 0);
+    EXPECT_EQ(parser.getEdidData(), std::nullopt);
+    EXPECT_EQ(parser.getView(), std::nullopt);
+    EXPECT_EQ(parser.feed(m_edid), Failed);
+  }
+}
+
+TEST_F_S(Reset) {
+  EdidStreamParser parser {EdidStreamParser::Scope::BaseBlock};
+  EXPECT_EQ(parser.feed(m_data), Complete);
+
+  parser.reset();
+  EXPECT_EQ(parser.getStatus(), NeedMoreData);
+  EXPECT_EQ(parser.getEdidData(), std::nullopt);
+  EXPECT_EQ(parser.feed(m_data), Complete);
+  EXPECT_EQ(parser.getView()->getBlockCount(), 1);
+}
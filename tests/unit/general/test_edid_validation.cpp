@@ -0,0 +1,96 @@
+// system includes
+#include <gmock/gmock.h>
+#include <random>
+
+// local includes
+#include "display_device/detail/edid_checksum.h"
+#include "display_device/edid_validation.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Convenience keywords
+  using display_device::EdidValidationResult;
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, EdidValidation, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Valid) {
+  EXPECT_EQ(display_device::validateEdid(ut_consts::DEFAULT_EDID), EdidValidationResult::Valid);
+  EXPECT_EQ(display_device::validateEdid(makeEdidWithExtensions(ut_consts::DEFAULT_EDID, {{0x02, 0x03}, {0x70}})), EdidValidationResult::Valid);
+}
+
+TEST_S(InvalidSize) {
+  EXPECT_EQ(display_device::validateEdid({}), EdidValidationResult::InvalidSize);
+  EXPECT_EQ(display_device::validateEdid(std::span {ut_consts::DEFAULT_EDID}.first(127)), EdidValidationResult::InvalidSize);
+}
+
+TEST_S(InvalidHeader) {
+  auto EDID_DATA {ut_consts::DEFAULT_EDID};
+  EDID_DATA[1] = std::byte {0xAA};
+  EXPECT_EQ(display_device::validateEdid(EDID_DATA), EdidValidationResult::InvalidHeader);
+}
+
+TEST_S(InvalidChecksum, BaseBlock) {
+  auto EDID_DATA {ut_consts::DEFAULT_EDID};
+  EDID_DATA[16] = std::byte {0x00};
+  EXPECT_EQ(display_device::validateEdid(EDID_DATA), EdidValidationResult::InvalidChecksum);
+}
+
+TEST_S(InvalidChecksum, ExtensionBlock) {
+  auto EDID_DATA {makeEdidWithExtensions(ut_consts::DEFAULT_EDID, {{0x02, 0x03}, {0x70}})};
+  EDID_DATA[2 * 128 + 5] = std::byte {0x01};
+  EXPECT_EQ(display_device::validateEdid(EDID_DATA), EdidValidationResult::InvalidChecksum);
+
+  // Block is not validated if it is not declared
+  EDID_DATA[126] = std::byte {0x01};
+  EDID_DATA[127] = std::byte {static_cast<std::uint8_t>(static_cast<int>(EDID_DATA[127]) + 1)};
+  EXPECT_EQ(display_device::validateEdid(EDID_DATA), EdidValidationResult::Valid);
+}
+
+TEST_S(Batch) {
+  auto BAD_HEADER {ut_consts::DEFAULT_EDID};
+  BAD_HEADER[0] = std::byte {0x01};
+  auto BAD_CHECKSUM {ut_consts::DEFAULT_EDID};
+  BAD_CHECKSUM[20] = std::byte {0x01};
+
+  const std::vector<std::span<const std::byte>> edids {ut_consts::DEFAULT_EDID, BAD_HEADER, {}, BAD_CHECKSUM};
+  std::vector<EdidValidationResult> results(edids.size());
+  display_device::validateEdids(edids, results);
+
+  EXPECT_EQ(results, (std::vector {EdidValidationResult::Valid, EdidValidationResult::InvalidHeader, EdidValidationResult::InvalidSize, EdidValidationResult::InvalidChecksum}));
+}
+
+TEST_S(Batch, SizeMismatch) {
+  const std::vector<std::span<const std::byte>> edids {ut_consts::DEFAULT_EDID};
+  std::vector<EdidValidationResult> results;
+
+  EXPECT_THAT([&]() {
+    display_device::validateEdids(edids, results);
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Result count does not match the EDID count in validateEdids!")));
+}
+
+TEST_S(BlockSumImplementations) {
+  const auto impls {display_device::detail::getSupportedEdidBlockSumImpls()};
+  ASSERT_FALSE(impls.empty());
+  EXPECT_EQ(impls.front().m_name, "scalar");
+  EXPECT_EQ(impls.back().m_function, display_device::detail::getEdidBlockSumFunction());
+
+  std::mt19937 generator {1337};
+  std::uniform_int_distribution<int> distribution {0, 255};
+  std::array<std::byte, 128> block {};
+  for (int iteration {0}; iteration < 100; ++iteration) {
+    for (auto &byte : block) {
+      byte = std::byte {static_cast<std::uint8_t>(distribution(generator))};
+    }
+
+    const auto expected_sum {impls.front().m_function(block.data())};
+    for (const auto &impl : impls) {
+      EXPECT_EQ(impl.m_function(block.data()), expected_sum) << impl.m_name;
+    }
+  }
+}
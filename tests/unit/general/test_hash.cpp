@@ -0,0 +1,44 @@
+// system includes
+#include <algorithm>
+#include <string_view>
+
+// local includes
+#include "display_device/detail/hash.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords
+  using display_device::detail::Hash128;
+
+  std::span<const std::byte> toBytes(const std::string_view value) {
+    return std::as_bytes(std::span {value});
+  }
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, Hash, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Hash128, ReferenceValues) {
+  // Reference values from the original MurmurHash3_x64_128 implementation
+  EXPECT_EQ(display_device::detail::hashBytes128({}), (Hash128 {0, 0}));
+  EXPECT_EQ(display_device::detail::hashBytes128(toBytes("hello")), (Hash128 {0xCBD8A7B341BD9B02ULL, 0x5B1E906A48AE1D19ULL}));
+}
+
+TEST_S(Hash128, Seed) {
+  EXPECT_NE(display_device::detail::hashBytes128(toBytes("hello"), 1), display_device::detail::hashBytes128(toBytes("hello"), 2));
+}
+
+TEST_S(Hash128, AllTailSizes) {
+  const std::string_view data {"0123456789abcdefghijklmnopqrstuvwxyz"};
+
+  std::vector<Hash128> hashes;
+  for (std::size_t size {0}; size <= data.size(); ++size) {
+    const auto hash {display_device::detail::hashBytes128(toBytes(data.substr(0, size)))};
+    EXPECT_EQ(std::ranges::find(hashes, hash), std::end(hashes)) << "size: " << size;
+    hashes.push_back(hash);
+  }
+}
+
+TEST_S(Hash64) {
+  EXPECT_EQ(display_device::detail::hashBytes64(toBytes("hello")), 0xCBD8A7B341BD9B02ULL);
+}
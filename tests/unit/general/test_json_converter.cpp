@@ -17,6 +17,14 @@ TEST_F_S(EdidData) {
   executeTestCase(item, R"({"manufacturer_id":"LOL","product_code":"ABCD","serial_number":777777})");
 }
 
+TEST_F_S(EdidData, FieldTooLong) {
+  display_device::EdidData item {};
+  std::string error_message {};
+
+  EXPECT_FALSE(display_device::fromJson(R"({"manufacturer_id":"LOLZ","product_code":"ABCD","serial_number":777777})", item, &error_message));
+  EXPECT_EQ(error_message, "String \"LOLZ\" exceeds the maximum length of 3!");
+}
+
 TEST_F_S(EnumeratedDevice) {
   display_device::EnumeratedDevice item_1 {
     "ID_1",
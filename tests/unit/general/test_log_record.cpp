@@ -0,0 +1,124 @@
+// system includes
+#include <limits>
+
+// local includes
+#include "display_device/log_record.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords
+  using display_device::logField;
+  using display_device::LogRecord;
+
+  struct StreamableStruct {
+    int m_value;
+  };
+
+  std::ostream &operator<<(std::ostream &stream, const StreamableStruct &value) {
+    return stream << "Streamable(" << value.m_value << ")";
+  }
+
+  /**
+   * @brief The same values streamed via the std::ostream for comparison.
+   */
+  template<class... Args>
+  std::string streamAll(const Args &...args) {
+    std::ostringstream stream;
+    (stream << ... << args);
+    return stream.str();
+  }
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, LogRecordTest, __VA_ARGS__)
+}  // namespace
+
+TEST_S(Empty) {
+  const LogRecord record;
+  EXPECT_TRUE(record.empty());
+  EXPECT_TRUE(record.getFields().empty());
+  EXPECT_EQ(record.format(), "");
+}
+
+TEST_S(Fields) {
+  LogRecord record;
+  record.append({}, "Hello");
+  record.append("flag", true);
+  record.append("int", -5);
+  record.append("uint", 5u);
+  record.append("double", 0.5f);
+  record.append("char", 'c');
+  record.append("struct", StreamableStruct {7});
+  EXPECT_FALSE(record.empty());
+
+  const auto fields {record.getFields()};
+  ASSERT_EQ(fields.size(), 7);
+  EXPECT_EQ(fields[0].m_name, "");
+  EXPECT_EQ(std::get<std::string_view>(fields[0].m_value), "Hello");
+  EXPECT_EQ(fields[1].m_name, "flag");
+  EXPECT_EQ(std::get<bool>(fields[1].m_value), true);
+  EXPECT_EQ(fields[2].m_name, "int");
+  EXPECT_EQ(std::get<std::int64_t>(fields[2].m_value), -5);
+  EXPECT_EQ(fields[3].m_name, "uint");
+  EXPECT_EQ(std::get<std::uint64_t>(fields[3].m_value), 5);
+  EXPECT_EQ(fields[4].m_name, "double");
+  EXPECT_EQ(std::get<double>(fields[4].m_value), 0.5);
+  EXPECT_EQ(fields[5].m_name, "char");
+  EXPECT_EQ(std::get<std::string_view>(fields[5].m_value), "c");
+  EXPECT_EQ(fields[6].m_name, "struct");
+  EXPECT_EQ(std::get<std::string_view>(fields[6].m_value), "Streamable(7)");
+}
+
+TEST_S(Format, SameAsStream) {
+  const std::string string {"string"};
+  const std::int64_t int_min {std::numeric_limits<std::int64_t>::min()};
+  const std::uint64_t uint_max {std::numeric_limits<std::uint64_t>::max()};
+
+  LogRecord record;
+  record.append({}, "Hello ");
+  record.append({}, string);
+  record.append({}, ' ');
+  record.append({}, true);
+  record.append({}, false);
+  record.append({}, ' ');
+  record.append({}, int_min);
+  record.append({}, ' ');
+  record.append({}, uint_max);
+  record.append({}, ' ');
+  record.append({}, 59.94);
+  record.append({}, ' ');
+  record.append({}, 1.0 / 3.0);
+  record.append({}, ' ');
+  record.append({}, 1e20);
+  record.append({}, ' ');
+  record.append({}, StreamableStruct {1});
+
+  EXPECT_EQ(record.format(), streamAll("Hello ", string, ' ', true, false, ' ', int_min, ' ', uint_max, ' ', 59.94, ' ', 1.0 / 3.0, ' ', 1e20, ' ', StreamableStruct {1}));
+}
+
+TEST_S(Format, NamedFields) {
+  LogRecord record;
+  record.append({}, "Applying mode ");
+  record.append("width", 1920);
+  record.append({}, "x");
+  record.append("height", 1080);
+
+  EXPECT_EQ(record.format(), "Applying mode width=1920xheight=1080");
+}
+
+TEST_S(Encoded) {
+  LogRecord record;
+  record.append({}, "Applying mode ");
+  record.append("width", 1920);
+
+  const auto copy {LogRecord::fromEncoded(record.getEncoded())};
+  EXPECT_EQ(copy, record);
+  EXPECT_EQ(copy.format(), "Applying mode width=1920");
+  EXPECT_TRUE(LogRecord::fromEncoded({}).empty());
+}
+
+TEST_S(LogField) {
+  const int value {5};
+  const auto field {logField("name", value)};
+  EXPECT_EQ(field.m_name, "name");
+  EXPECT_EQ(&field.m_value, &value);
+}
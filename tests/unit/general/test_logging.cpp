@@ -1,8 +1,49 @@
+// system includes
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <gmock/gmock.h>
+#include <latch>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
 // local includes
 #include "display_device/logging.h"
 #include "fixtures/fixtures.h"
 
 namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  struct StreamableStruct {
+    int m_value;
+  };
+
+  std::ostream &operator<<(std::ostream &stream, const StreamableStruct &value) {
+    return stream << "Streamable(" << value.m_value << ")";
+  }
+
+  /**
+   * @brief Get the numbers that follow the prefix in the matching lines.
+   * @note The DD_LOG_EVERY_* call site state outlives the test (e.g. with --gtest_repeat),
+   *       so the tests check the numbers relative to the first logged one.
+   */
+  std::vector<int> getNumbers(const std::vector<std::string> &output, const std::string_view prefix) {
+    std::vector<int> numbers;
+    for (const auto &value : output) {
+      if (value.starts_with(prefix)) {
+        numbers.push_back(std::stoi(value.substr(prefix.size())));
+      }
+    }
+    return numbers;
+  }
+
   // Specialized TEST macro(s) for this test file
 #define TEST_S(...) DD_MAKE_TEST(TEST, LoggingTest, __VA_ARGS__)
 }  // namespace
@@ -206,3 +247,1031 @@ TEST_S(LogMacroDisablesStreamChain) {
   EXPECT_EQ(output_logged, true);
   EXPECT_EQ(some_function_invoked, true);
 }
+
+TEST_S(Async, DefaultLogger) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  EXPECT_FALSE(logger.isAsyncEnabled());
+  logger.enableAsync({});
+  EXPECT_TRUE(logger.isAsyncEnabled());
+
+  logger.write(level::info, "Hello World!");
+  logger.flush();
+  EXPECT_TRUE(testRegex(m_cout_buffer.str(), R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] INFO:    Hello World!\n)"));
+
+  logger.disableAsync();
+  EXPECT_FALSE(logger.isAsyncEnabled());
+}
+
+TEST_S(Async, CustomCallback, PreservesOrder) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.enableAsync({.m_capacity = 8, .m_overflow_policy = display_device::Logger::OverflowPolicy::Block});
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+  EXPECT_TRUE(logger.isAsyncEnabled());
+
+  std::vector<std::string> expected_output;
+  for (int i {0}; i < 100; ++i) {
+    expected_output.push_back(std::to_string(i));
+    logger.write(level::info, expected_output.back());
+  }
+
+  logger.flush();
+  EXPECT_EQ(output, expected_output);
+  EXPECT_EQ(logger.getDroppedRecordCount(), 0);
+}
+
+TEST_S(Async, MultipleProducers) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  constexpr int thread_count {4};
+  constexpr int records_per_thread {1000};
+
+  std::vector<int> last_values(thread_count, -1);
+  bool is_ordered {true};
+  int total_count {0};
+  logger.setCustomCallback([&](auto, const std::string &value) {
+    const auto separator {value.find(':')};
+    const auto thread_index {std::stoi(value.substr(0, separator))};
+    const auto record_index {std::stoi(value.substr(separator + 1))};
+
+    is_ordered = is_ordered && last_values[thread_index] + 1 == record_index;
+    last_values[thread_index] = record_index;
+    ++total_count;
+  });
+  logger.enableAsync({.m_capacity = 16, .m_overflow_policy = display_device::Logger::OverflowPolicy::Block});
+
+  std::vector<std::thread> threads;
+  for (int i {0}; i < thread_count; ++i) {
+    threads.emplace_back([&logger, i]() {
+      for (int j {0}; j < records_per_thread; ++j) {
+        logger.write(level::info, std::to_string(i) + ":" + std::to_string(j));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  logger.flush();
+  EXPECT_EQ(total_count, thread_count * records_per_thread);
+  EXPECT_TRUE(is_ordered);
+  EXPECT_EQ(logger.getDroppedRecordCount(), 0);
+}
+
+TEST_S(Async, OverflowPolicy, Drop) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::promise<void> callback_entered;
+  std::promise<void> release_callback;
+  std::shared_future<void> release_future {release_callback.get_future().share()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&](auto, std::string value) {
+    if (output.empty()) {
+      callback_entered.set_value();
+      release_future.wait();
+    }
+    output.push_back(std::move(value));
+  });
+  logger.enableAsync({.m_capacity = 2, .m_overflow_policy = display_device::Logger::OverflowPolicy::Drop});
+
+  // The first record stalls the writer thread
+  logger.write(level::info, "0");
+  callback_entered.get_future().wait();
+
+  for (int i {1}; i < 6; ++i) {
+    logger.write(level::info, std::to_string(i));
+  }
+  EXPECT_EQ(logger.getDroppedRecordCount(), 3);
+
+  release_callback.set_value();
+  logger.flush();
+  EXPECT_EQ(output, (std::vector<std::string> {"0", "1", "2"}));
+}
+
+TEST_S(Async, OverflowPolicy, Count) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::promise<void> callback_entered;
+  std::promise<void> release_callback;
+  std::shared_future<void> release_future {release_callback.get_future().share()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&](auto, std::string value) {
+    if (output.empty()) {
+      callback_entered.set_value();
+      release_future.wait();
+    }
+    output.push_back(std::move(value));
+  });
+  logger.enableAsync({.m_capacity = 2, .m_overflow_policy = display_device::Logger::OverflowPolicy::Count});
+
+  // The first record stalls the writer thread
+  logger.write(level::info, "0");
+  callback_entered.get_future().wait();
+
+  for (int i {1}; i < 6; ++i) {
+    logger.write(level::info, std::to_string(i));
+  }
+  EXPECT_EQ(logger.getDroppedRecordCount(), 3);
+
+  release_callback.set_value();
+  logger.flush();
+  EXPECT_EQ(output.size(), 4);
+  EXPECT_EQ(output[0], "0");
+  EXPECT_EQ(output[1], "Dropped 3 log record(s) due to the full queue!");
+  EXPECT_EQ(output[2], "1");
+  EXPECT_EQ(output[3], "2");
+}
+
+TEST_S(Async, LoggingFromCallback) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&](auto, std::string value) {
+    if (value == "outer") {
+      logger.write(level::info, "inner");
+      logger.flush();
+    }
+    output.push_back(std::move(value));
+  });
+  logger.enableAsync({.m_capacity = 2, .m_overflow_policy = display_device::Logger::OverflowPolicy::Block});
+
+  logger.write(level::info, "outer");
+  logger.flush();
+  EXPECT_EQ(output, (std::vector<std::string> {"inner", "outer"}));
+}
+
+TEST_S(Async, DisableWritesQueuedRecords) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  int count {0};
+  logger.setCustomCallback([&count](auto, auto) {
+    ++count;
+  });
+  logger.enableAsync({.m_capacity = 128, .m_overflow_policy = display_device::Logger::OverflowPolicy::Block});
+
+  for (int i {0}; i < 100; ++i) {
+    logger.write(level::info, "Hello World!");
+  }
+
+  logger.disableAsync();
+  EXPECT_EQ(count, 100);
+  EXPECT_EQ(logger.getDroppedRecordCount(), 0);
+}
+
+TEST_S(Async, ToggledWhileLogging) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+  constexpr int thread_count {4};
+  constexpr int records_per_thread {2000};
+
+  std::atomic<int> count {0};
+  logger.setCustomCallback([&count](auto, auto) {
+    ++count;
+  });
+
+  std::atomic<bool> start {false};
+  std::vector<std::thread> threads;
+  for (int i {0}; i < thread_count; ++i) {
+    threads.emplace_back([&]() {
+      while (!start) {
+        std::this_thread::yield();
+      }
+      for (int j {0}; j < records_per_thread; ++j) {
+        logger.write(level::info, "Hello World!");
+      }
+    });
+  }
+
+  start = true;
+  for (int i {0}; i < 50; ++i) {
+    logger.enableAsync({.m_capacity = 16, .m_overflow_policy = display_device::Logger::OverflowPolicy::Block});
+    logger.disableAsync();
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(count, thread_count * records_per_thread);
+}
+
+TEST_S(LogRecordMacro, DefaultLogger) {
+  DD_LOG_RECORD(info) << "Applying mode " << display_device::logField("width", 1920) << " " << display_device::logField("height", 1080);
+  EXPECT_TRUE(testRegex(m_cout_buffer.str(), R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] INFO:    Applying mode width=1920 height=1080\n)"));
+}
+
+TEST_S(LogRecordMacro, CustomCallback) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output = std::move(value);
+  });
+
+  DD_LOG_RECORD(info) << "Applying mode " << display_device::logField("width", 1920);
+  EXPECT_EQ(output, "Applying mode width=1920");
+
+  logger.setLogLevel(level::error);
+  output.clear();
+  DD_LOG_RECORD(info) << "Applying mode " << display_device::logField("width", 1920);
+  EXPECT_EQ(output, "");
+}
+
+TEST_S(LogRecordMacro, Category) {
+  using level = display_device::Logger::LogLevel;
+  using category = display_device::Logger::LogCategory;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+
+  logger.setLogLevel(level::info);
+  logger.setLogLevel(category::edid, level::verbose);
+  DD_LOG_CATEGORY_RECORD(edid, verbose) << "edid " << display_device::logField("width", 1920);
+  DD_LOG_CATEGORY_RECORD(json, verbose) << "json " << display_device::logField("width", 1920);
+  DD_LOG_RECORD(verbose) << "general " << display_device::logField("width", 1920);
+  EXPECT_EQ(output, std::vector<std::string> {"edid width=1920"});
+}
+
+TEST_S(LogRecordMacro, RecordCallback) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> custom_output;
+  logger.setCustomCallback([&custom_output](auto, std::string value) {
+    custom_output.push_back(std::move(value));
+  });
+
+  // The fields are only valid within the callback
+  std::vector<std::string> field_names;
+  std::string formatted_output;
+  level output_level {level::verbose};
+  logger.setRecordCallback([&](const level level, const display_device::LogRecord &record) {
+    output_level = level;
+    field_names.clear();
+    for (const auto &field : record.getFields()) {
+      field_names.emplace_back(field.m_name);
+    }
+    formatted_output = record.format();
+  });
+
+  // Both callbacks are invoked
+  DD_LOG_RECORD(warning) << "Mode " << display_device::logField("width", 1920);
+  EXPECT_EQ(custom_output, std::vector<std::string> {"Mode width=1920"});
+  EXPECT_EQ(output_level, level::warning);
+  EXPECT_EQ(field_names, (std::vector<std::string> {"", "width"}));
+  EXPECT_EQ(formatted_output, "Mode width=1920");
+
+  // Plain logs are passed as a single unnamed field
+  logger.write(level::info, "Hello World!");
+  EXPECT_EQ(custom_output, (std::vector<std::string> {"Mode width=1920", "Hello World!"}));
+  EXPECT_EQ(output_level, level::info);
+  EXPECT_EQ(field_names, (std::vector<std::string> {""}));
+  EXPECT_EQ(formatted_output, "Hello World!");
+
+  // Without the custom callback, the record callback replaces the standard output
+  logger.setCustomCallback(nullptr);
+  DD_LOG_RECORD(info) << "Mode " << display_device::logField("width", 1920);
+  EXPECT_EQ(formatted_output, "Mode width=1920");
+  EXPECT_EQ(m_cout_buffer.str(), "");
+}
+
+TEST_S(LogRecordMacro, Async) {
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output = std::move(value);
+  });
+  logger.enableAsync({});
+
+  DD_LOG_RECORD(info) << "Applying mode " << display_device::logField("width", 1920);
+  logger.flush();
+  EXPECT_EQ(output, "Applying mode width=1920");
+}
+
+TEST_S(Category, LogLevels) {
+  using category = display_device::Logger::LogCategory;
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  logger.setLogLevel(level::info);
+  for (std::size_t i {0}; i < display_device::Logger::LOG_CATEGORY_COUNT; ++i) {
+    EXPECT_EQ(logger.getLogLevel(static_cast<category>(i)), level::info);
+  }
+
+  logger.setLogLevel(category::edid, level::verbose);
+  logger.setLogLevel(category::platform, level::error);
+  EXPECT_EQ(logger.getLogLevel(category::general), level::info);
+  EXPECT_EQ(logger.getLogLevel(category::edid), level::verbose);
+  EXPECT_EQ(logger.getLogLevel(category::platform), level::error);
+
+  EXPECT_EQ(logger.isLogLevelEnabled(level::verbose), false);
+  EXPECT_EQ(logger.isLogLevelEnabled(category::general, level::verbose), false);
+  EXPECT_EQ(logger.isLogLevelEnabled(category::edid, level::verbose), true);
+  EXPECT_EQ(logger.isLogLevelEnabled(category::scheduler, level::verbose), false);
+  EXPECT_EQ(logger.isLogLevelEnabled(category::platform, level::warning), false);
+  EXPECT_EQ(logger.isLogLevelEnabled(category::platform, level::error), true);
+
+  // Global level overrides all of the categories
+  logger.setLogLevel(level::warning);
+  EXPECT_EQ(logger.getLogLevel(category::edid), level::warning);
+  EXPECT_EQ(logger.getLogLevel(category::platform), level::warning);
+}
+
+TEST_S(Category, WriteMethodRespectsLogLevel) {
+  using category = display_device::Logger::LogCategory;
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+
+  logger.setLogLevel(level::info);
+  logger.setLogLevel(category::edid, level::verbose);
+
+  logger.write(category::edid, level::verbose, "edid");
+  logger.write(category::scheduler, level::verbose, "scheduler");
+  logger.write(level::verbose, "general");
+  logger.write(category::edid, level::verbose, display_device::LogRecord {});
+  EXPECT_EQ(output, (std::vector<std::string> {"edid", ""}));
+}
+
+TEST_S(Category, LogMacroDisablesStreamChain) {
+  using category = display_device::Logger::LogCategory;
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+
+  int some_function_invoked {0};
+  const auto some_function {[&some_function_invoked]() {
+    ++some_function_invoked;
+    return "some string";
+  }};
+
+  logger.setLogLevel(level::info);
+  logger.setLogLevel(category::platform, level::verbose);
+  DD_LOG_CATEGORY(platform, verbose) << "platform " << some_function();
+  DD_LOG_CATEGORY(edid, verbose) << "edid " << some_function();
+  DD_LOG(verbose) << "general " << some_function();
+  EXPECT_EQ(some_function_invoked, 1);
+  EXPECT_EQ(output, (std::vector<std::string> {"platform some string"}));
+}
+
+TEST_S(LogEveryN) {
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+
+  for (int i {0}; i < 10; ++i) {
+    DD_LOG_EVERY_N(info, 3) << "every 3: " << i;
+    DD_LOG_EVERY_N(info, 0) << "every 0: " << i;
+  }
+
+  EXPECT_EQ(getNumbers(output, "every 0: ").size(), 10);
+
+  const auto every_3 {getNumbers(output, "every 3: ")};
+  ASSERT_FALSE(every_3.empty());
+  EXPECT_LT(every_3.front(), 3);
+  EXPECT_GE(every_3.back(), 10 - 3);
+  for (std::size_t i {1}; i < every_3.size(); ++i) {
+    EXPECT_EQ(every_3[i] - every_3[i - 1], 3);
+  }
+}
+
+TEST_S(LogEveryN, DisabledLevelIsNotCounted) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+
+  for (int i {0}; i < 4; ++i) {
+    logger.setLogLevel(i < 2 ? level::error : level::verbose);
+    DD_LOG_EVERY_N(info, 2) << i;
+  }
+  EXPECT_EQ(output, (std::vector<std::string> {"2"}));
+}
+
+TEST_S(LogEveryN, Category) {
+  using level = display_device::Logger::LogLevel;
+  using category = display_device::Logger::LogCategory;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+
+  // The hourly statement is only logged by the first run of the test
+  static bool is_first_run {true};
+  const bool expect_hourly {std::exchange(is_first_run, false)};
+
+  logger.setLogLevel(category::scheduler, level::error);
+  for (int i {0}; i < 4; ++i) {
+    DD_LOG_CATEGORY_EVERY_N(scheduler, warning, 2) << "warning: " << i;
+    DD_LOG_CATEGORY_EVERY_N(scheduler, error, 2) << "error: " << i;
+    DD_LOG_CATEGORY_EVERY_MS(scheduler, error, 3600000) << "hourly: " << i;
+  }
+  logger.setLogLevel(level::info);
+  EXPECT_EQ(getNumbers(output, "warning: "), std::vector<int> {});
+  EXPECT_EQ(getNumbers(output, "error: "), (std::vector<int> {0, 2}));
+  EXPECT_EQ(getNumbers(output, "hourly: "), expect_hourly ? std::vector<int> {0} : std::vector<int> {});
+}
+
+TEST_S(LogEveryMs) {
+  using namespace std::chrono_literals;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+
+  // The hourly statement is only logged by the first run of the test
+  static bool is_first_run {true};
+  const bool expect_hourly {std::exchange(is_first_run, false)};
+
+  for (int i {0}; i < 3; ++i) {
+    DD_LOG_EVERY_MS(info, 3600000) << "hourly: " << i;
+  }
+  EXPECT_EQ(output, expect_hourly ? std::vector<std::string> {"hourly: 0"} : std::vector<std::string> {});
+
+  output.clear();
+  for (int i {0}; i < 2; ++i) {
+    DD_LOG_EVERY_MS(info, 1) << "every 1ms: " << i;
+    std::this_thread::sleep_for(5ms);
+  }
+  EXPECT_EQ(output, (std::vector<std::string> {"every 1ms: 0", "every 1ms: 1"}));
+}
+
+TEST_S(Deduplication) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](const level level, std::string value) {
+    output.push_back(std::to_string(static_cast<int>(level)) + " " + value);
+  });
+
+  EXPECT_FALSE(logger.isDeduplicationEnabled());
+  logger.setDeduplicationEnabled(true);
+  EXPECT_TRUE(logger.isDeduplicationEnabled());
+
+  for (int i {0}; i < 3; ++i) {
+    logger.write(level::error, "Failed to revert settings!");
+  }
+  logger.write(level::info, "Failed to revert settings!");
+  logger.write(level::info, "Something else");
+  logger.write(level::info, "Something else");
+  EXPECT_EQ(output, (std::vector<std::string> {
+                      "4 Failed to revert settings!",
+                      "4 Last message repeated 2 time(s).",
+                      "2 Failed to revert settings!",
+                      "2 Something else",
+                    }));
+
+  output.clear();
+  logger.flush();
+  EXPECT_EQ(output, (std::vector<std::string> {"2 Last message repeated 1 time(s)."}));
+
+  // Repeats are reported when disabled too
+  output.clear();
+  logger.write(level::info, "Something else");
+  logger.setDeduplicationEnabled(false);
+  EXPECT_EQ(output, (std::vector<std::string> {"2 Last message repeated 1 time(s)."}));
+
+  output.clear();
+  logger.write(level::info, "Something else");
+  logger.write(level::info, "Something else");
+  EXPECT_EQ(output, (std::vector<std::string> {"2 Something else", "2 Something else"}));
+}
+
+TEST_S(Deduplication, Records) {
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+  logger.setDeduplicationEnabled(true);
+
+  for (int i {0}; i < 3; ++i) {
+    DD_LOG_RECORD(info) << "Attempt " << display_device::logField("index", i / 2);
+  }
+  logger.flush();
+  logger.setDeduplicationEnabled(false);
+  EXPECT_EQ(output, (std::vector<std::string> {"Attempt index=0", "Last message repeated 1 time(s).", "Attempt index=1"}));
+}
+
+TEST_S(Deduplication, LoggingFromCallback) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&](auto, std::string value) {
+    if (value == "outer") {
+      logger.write(level::info, "inner");
+    }
+    output.push_back(std::move(value));
+  });
+  logger.setDeduplicationEnabled(true);
+
+  logger.write(level::info, "outer");
+  logger.setDeduplicationEnabled(false);
+  EXPECT_EQ(output, (std::vector<std::string> {"inner", "outer"}));
+}
+
+TEST_S(Deduplication, ToggledWhileLogging) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+  constexpr int thread_count {4};
+  constexpr int records_per_thread {2000};
+
+  std::atomic<int> count {0};
+  logger.setCustomCallback([&count](auto, auto) {
+    ++count;
+  });
+
+  std::atomic<bool> start {false};
+  std::vector<std::thread> threads;
+  for (int i {0}; i < thread_count; ++i) {
+    threads.emplace_back([&, i]() {
+      while (!start) {
+        std::this_thread::yield();
+      }
+      for (int j {0}; j < records_per_thread; ++j) {
+        logger.write(level::info, std::to_string(i) + ":" + std::to_string(j));
+      }
+    });
+  }
+
+  start = true;
+  for (int i {0}; i < 50; ++i) {
+    logger.setDeduplicationEnabled(true);
+    logger.setDeduplicationEnabled(false);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(count, thread_count * records_per_thread);
+}
+
+TEST_S(LogWriter, SameAsStream) {
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output = std::move(value);
+  });
+
+  const std::string string {"string"};
+  const std::string_view string_view {"string_view"};
+  const char *null_string {nullptr};
+  const auto write_values {[&](auto &stream) {
+    stream << "Hello " << string << ' ' << string_view << ' ' << true << false << ' '
+           << static_cast<signed char>('s') << static_cast<unsigned char>('u') << ' '
+           << -1 << ' ' << 2u << ' ' << std::numeric_limits<std::int64_t>::min() << ' ' << std::numeric_limits<std::uint64_t>::max() << ' '
+           << 59.94 << ' ' << 1.0f / 3.0f << ' ' << 1e20 << ' ' << 0.0 << ' ';
+    if (null_string) {
+      stream << null_string;
+    }
+    stream << StreamableStruct {5} << ' ' << 255 << ' ' << std::hex << 255 << ' ' << true;
+  }};
+
+  std::ostringstream expected_output;
+  write_values(expected_output);
+
+  {
+    display_device::LogWriter writer {display_device::Logger::LogLevel::info};
+    write_values(writer);
+    writer << null_string;
+  }
+  EXPECT_EQ(output, expected_output.str());
+  EXPECT_TRUE(output.ends_with("Streamable(5) 255 ff 1"));
+}
+
+TEST_S(LogWriter, LongLine) {
+  auto &logger {display_device::Logger::get()};
+
+  std::string output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output = std::move(value);
+  });
+
+  const std::string long_string(display_device::detail::LogBuffer::INLINE_CAPACITY - 1, 'a');
+  DD_LOG(info) << long_string << 'b' << 'c' << long_string << 123;
+  EXPECT_EQ(output, long_string + "bc" + long_string + "123");
+}
+
+TEST_S(LogWriter, Buffer) {
+  display_device::detail::LogBuffer buffer;
+  EXPECT_EQ(buffer.view(), "");
+  EXPECT_FALSE(buffer.isSpilled());
+
+  buffer.append(std::string(display_device::detail::LogBuffer::INLINE_CAPACITY - 3, 'a'));
+  buffer.appendNumber(123);
+  EXPECT_FALSE(buffer.isSpilled());
+  EXPECT_EQ(buffer.view().size(), display_device::detail::LogBuffer::INLINE_CAPACITY);
+
+  buffer.appendNumber(4.5);
+  EXPECT_TRUE(buffer.isSpilled());
+  EXPECT_TRUE(buffer.view().ends_with("aaa1234.5"));
+}
+
+TEST_S(Sinks, IndependentLogLevels) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> primary_output;
+  std::vector<std::string> warning_output;
+  std::vector<std::string> verbose_output;
+  logger.setCustomCallback([&primary_output](auto, std::string value) {
+    primary_output.push_back(std::move(value));
+  });
+  logger.addSink(level::warning, [&warning_output](auto, std::string value) {
+    warning_output.push_back(std::move(value));
+  });
+  logger.addSink(level::verbose, [&verbose_output](auto, std::string value) {
+    verbose_output.push_back(std::move(value));
+  });
+
+  logger.setLogLevel(level::debug);
+  DD_LOG(verbose) << "Filtered by the logger";
+  DD_LOG(debug) << "Debug";
+  DD_LOG(error) << "Error";
+
+  const std::vector<std::string> all_output {"Debug", "Error"};
+  EXPECT_EQ(primary_output, all_output);
+  EXPECT_EQ(verbose_output, all_output);
+  EXPECT_EQ(warning_output, std::vector<std::string> {"Error"});
+}
+
+TEST_S(Sinks, DefaultLoggerIsStillUsed) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.addSink(level::verbose, [&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+
+  DD_LOG(info) << "Hello World!";
+  EXPECT_EQ(output, std::vector<std::string> {"Hello World!"});
+  EXPECT_TRUE(testRegex(m_cout_buffer.str(), R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] INFO:    Hello World!\n)"));
+}
+
+TEST_S(Sinks, Records) {
+  using level = display_device::Logger::LogLevel;
+  using display_device::logField;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  int record_count {0};
+  logger.setRecordCallback([&record_count](auto, const display_device::LogRecord &) {
+    ++record_count;
+  });
+  logger.addSink(level::verbose, [&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+
+  DD_LOG_RECORD(info) << "Mode " << logField("width", 1920);
+  DD_LOG(info) << "Text";
+  EXPECT_EQ(output, (std::vector<std::string> {"Mode width=1920", "Text"}));
+  EXPECT_EQ(record_count, 2);
+}
+
+TEST_S(Sinks, ChangedFromWithinCallback) {
+  auto &logger {display_device::Logger::get()};
+  logger.setCustomCallback([](auto, auto) {});
+
+  // One-shot sink that removes itself
+  std::vector<std::string> output;
+  std::optional<display_device::Logger::SinkId> id;
+  id = logger.addSink(display_device::Logger::LogLevel::verbose, [&](auto, std::string value) {
+    output.push_back(std::move(value));
+    logger.removeSink(*id);
+  });
+
+  DD_LOG(info) << "First";
+  DD_LOG(info) << "Second";
+  EXPECT_EQ(output, std::vector<std::string> {"First"});
+
+  // Callback that replaces itself
+  logger.setCustomCallback([&](auto, std::string value) {
+    output.push_back("old: " + value);
+    logger.setCustomCallback([&output](auto, std::string value) {
+      output.push_back("new: " + value);
+    });
+  });
+
+  DD_LOG(info) << "Third";
+  DD_LOG(info) << "Fourth";
+  EXPECT_EQ(output, (std::vector<std::string> {"First", "old: Third", "new: Fourth"}));
+}
+
+TEST_S(Sinks, ModeSwitchFromWithinCallback) {
+  auto &logger {display_device::Logger::get()};
+
+  bool callback_invoked {false};
+  logger.setCustomCallback([&](auto, auto) {
+    EXPECT_THROW(logger.enableAsync({}), std::logic_error);
+    EXPECT_THROW(logger.disableAsync(), std::logic_error);
+    EXPECT_THROW(logger.setDeduplicationEnabled(true), std::logic_error);
+    callback_invoked = true;
+  });
+
+  DD_LOG(info) << "Hello World!";
+  EXPECT_TRUE(callback_invoked);
+  EXPECT_FALSE(logger.isAsyncEnabled());
+  EXPECT_FALSE(logger.isDeduplicationEnabled());
+}
+
+TEST_S(Sinks, ChangeAndRemove) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+  logger.setCustomCallback([](auto, auto) {});
+
+  std::vector<std::string> output;
+  const auto id {logger.addSink(level::error, [&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  })};
+
+  DD_LOG(info) << "1";
+  EXPECT_TRUE(logger.setSinkLogLevel(id, level::info));
+  DD_LOG(info) << "2";
+  EXPECT_TRUE(logger.removeSink(id));
+  DD_LOG(info) << "3";
+
+  EXPECT_EQ(output, std::vector<std::string> {"2"});
+  EXPECT_FALSE(logger.setSinkLogLevel(id, level::info));
+  EXPECT_FALSE(logger.removeSink(id));
+}
+
+TEST_S(Sinks, EmptyCallback) {
+  using level = display_device::Logger::LogLevel;
+  EXPECT_THAT([]() {
+    static_cast<void>(display_device::Logger::get().addSink(level::info, nullptr));
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Logger::addSink requires a callback!")));
+}
+
+TEST_S(Sinks, ChangedWhileLogging) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::atomic<int> first_count {0};
+  std::atomic<int> second_count {0};
+  const auto first_callback {[&first_count](auto, auto) {
+    ++first_count;
+  }};
+  const auto second_callback {[&second_count](auto, auto) {
+    ++second_count;
+  }};
+  logger.setCustomCallback(first_callback);
+
+  constexpr int thread_count {4};
+  constexpr int records_per_thread {2000};
+  std::atomic<bool> stop {false};
+  std::vector<std::thread> threads;
+  for (int i {0}; i < thread_count; ++i) {
+    threads.emplace_back([]() {
+      for (int j {0}; j < records_per_thread; ++j) {
+        DD_LOG(info) << "Record " << j;
+      }
+    });
+  }
+
+  std::thread reconfiguring_thread {[&]() {
+    bool use_first {false};
+    while (!stop.load()) {
+      logger.setCustomCallback(use_first ? display_device::Logger::Callback {first_callback} : display_device::Logger::Callback {second_callback});
+      const auto id {logger.addSink(level::verbose, [](auto, auto) {})};
+      logger.removeSink(id);
+      use_first = !use_first;
+    }
+  }};
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  stop = true;
+  reconfiguring_thread.join();
+
+  EXPECT_EQ(first_count + second_count, thread_count * records_per_thread);
+}
+
+TEST_S(FlightRecorder, CapturesDisabledLevels) {
+  using level = display_device::Logger::LogLevel;
+  using display_device::logField;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<std::string> output;
+  logger.setCustomCallback([&output](auto, std::string value) {
+    output.push_back(std::move(value));
+  });
+  logger.setLogLevel(level::error);
+  logger.enableFlightRecorder(16);
+  EXPECT_TRUE(logger.isFlightRecorderEnabled());
+
+  DD_LOG(verbose) << "Verbose " << 1;
+  DD_LOG_CATEGORY(edid, debug) << "Debug";
+  DD_LOG_RECORD(info) << logField("width", 1920);
+  logger.write(level::warning, "Warning");
+  DD_LOG(error) << "Error";
+
+  EXPECT_EQ(output, std::vector<std::string> {"Error"});
+
+  std::vector<std::string> lines;
+  std::istringstream stream {logger.dumpFlightRecorder()};
+  for (std::string line; std::getline(stream, line);) {
+    lines.push_back(line);
+  }
+  ASSERT_EQ(lines.size(), 5);
+  EXPECT_TRUE(testRegex(lines[0], R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] VERBOSE: \[\d+\] Verbose 1)"));
+  EXPECT_TRUE(testRegex(lines[1], R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] DEBUG:   \[\d+\] Debug)"));
+  EXPECT_TRUE(testRegex(lines[2], R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] INFO:    \[\d+\] width=1920)"));
+  EXPECT_TRUE(testRegex(lines[3], R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] WARNING: \[\d+\] Warning)"));
+  EXPECT_TRUE(testRegex(lines[4], R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] ERROR:   \[\d+\] Error)"));
+}
+
+TEST_S(FlightRecorder, KeepsLastRecords) {
+  auto &logger {display_device::Logger::get()};
+  logger.setCustomCallback([](auto, auto) {});
+  logger.enableFlightRecorder(3, display_device::Logger::LogLevel::debug);
+
+  for (int i {0}; i < 10; ++i) {
+    DD_LOG(debug) << "Record " << i;
+  }
+  DD_LOG(verbose) << "Not captured";
+  DD_LOG(debug) << std::string(display_device::Logger::FLIGHT_RECORDER_BYTES_PER_RECORD + 10, 'x');
+
+  const auto dump {logger.dumpFlightRecorder()};
+  EXPECT_EQ(dump.find("Record 7"), std::string::npos);
+  EXPECT_NE(dump.find("Record 8"), std::string::npos);
+  EXPECT_NE(dump.find("Record 9"), std::string::npos);
+  EXPECT_EQ(dump.find("Not captured"), std::string::npos);
+  EXPECT_NE(dump.find("] " + std::string(display_device::Logger::FLIGHT_RECORDER_BYTES_PER_RECORD + 10, 'x') + "\n"), std::string::npos);
+}
+
+TEST_S(FlightRecorder, Disabled) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+  logger.setLogLevel(level::error);
+
+  bool some_function_invoked {false};
+  const auto some_function {[&some_function_invoked]() {
+    some_function_invoked = true;
+    return "some string";
+  }};
+
+  logger.enableFlightRecorder(16);
+  logger.disableFlightRecorder();
+  EXPECT_FALSE(logger.isFlightRecorderEnabled());
+
+  DD_LOG(info) << some_function();
+  EXPECT_FALSE(some_function_invoked);
+  EXPECT_EQ(logger.dumpFlightRecorder(), "");
+}
+
+TEST_S(FlightRecorder, CapturedLevels) {
+  using level = display_device::Logger::LogLevel;
+  using category = display_device::Logger::LogCategory;
+  auto &logger {display_device::Logger::get()};
+  logger.setLogLevel(level::error);
+  logger.setLogLevel(category::edid, level::debug);
+  EXPECT_FALSE(logger.isLogLevelCaptured(category::general, level::info));
+  EXPECT_TRUE(logger.isLogLevelCaptured(category::edid, level::debug));
+
+  logger.enableFlightRecorder(16, level::info);
+  EXPECT_TRUE(logger.isLogLevelCaptured(category::general, level::info));
+  EXPECT_FALSE(logger.isLogLevelCaptured(category::general, level::debug));
+  EXPECT_TRUE(logger.isLogLevelCaptured(category::edid, level::debug));
+
+  logger.setLogLevel(category::general, level::verbose);
+  EXPECT_TRUE(logger.isLogLevelCaptured(category::general, level::verbose));
+
+  logger.disableFlightRecorder();
+  EXPECT_TRUE(logger.isLogLevelCaptured(category::general, level::verbose));
+  EXPECT_FALSE(logger.isLogLevelCaptured(category::json, level::info));
+}
+
+TEST_S(FlightRecorder, RecordsAreNotCut) {
+  auto &logger {display_device::Logger::get()};
+  logger.setCustomCallback([](auto, auto) {});
+  logger.enableFlightRecorder();
+
+  const std::string long_value(display_device::Logger::FLIGHT_RECORDER_BYTES_PER_RECORD + 10, 'x');
+  DD_LOG_RECORD(info) << display_device::logField("config", long_value);
+
+  EXPECT_NE(logger.dumpFlightRecorder().find("config=" + long_value + "\n"), std::string::npos);
+}
+
+TEST_S(FlightRecorder, LongTextEvictsOlderRecords) {
+  constexpr auto bytes_per_record {display_device::Logger::FLIGHT_RECORDER_BYTES_PER_RECORD};
+  auto &logger {display_device::Logger::get()};
+  logger.setCustomCallback([](auto, auto) {});
+  logger.enableFlightRecorder(2);
+
+  DD_LOG(info) << "Record 1";
+  DD_LOG(info) << std::string(bytes_per_record + 10, 'a');
+  DD_LOG(info) << std::string(bytes_per_record + 10, 'b');
+
+  const auto dump {logger.dumpFlightRecorder()};
+  EXPECT_EQ(dump.find("Record 1"), std::string::npos);
+  EXPECT_EQ(dump.find('a'), std::string::npos);
+  EXPECT_NE(dump.find("] " + std::string(bytes_per_record + 10, 'b') + "\n"), std::string::npos);
+}
+
+TEST_S(FlightRecorder, TooLongTextIsCut) {
+  constexpr auto bytes_per_record {display_device::Logger::FLIGHT_RECORDER_BYTES_PER_RECORD};
+  auto &logger {display_device::Logger::get()};
+  logger.setCustomCallback([](auto, auto) {});
+  logger.enableFlightRecorder(1);
+
+  DD_LOG(info) << std::string(bytes_per_record + 10, 'x');
+  DD_LOG_RECORD(info) << display_device::logField("config", std::string(bytes_per_record + 10, 'y'));
+
+  const auto dump {logger.dumpFlightRecorder()};
+  EXPECT_EQ(dump.find('x'), std::string::npos);
+  EXPECT_NE(dump.find("] config=" + std::string(bytes_per_record - 7, 'y') + "... (17 more characters cut)\n"), std::string::npos);
+}
+
+TEST_S(FlightRecorder, DumpWhileCapturing) {
+  auto &logger {display_device::Logger::get()};
+  logger.setLogLevel(display_device::Logger::LogLevel::fatal);
+  logger.enableFlightRecorder(8);
+
+  std::atomic<bool> stop {false};
+  std::thread thread {[&stop]() {
+    for (int i {0}; !stop.load(); ++i) {
+      DD_LOG(verbose) << "Record " << i << " " << std::string(i % 300, 'x');
+    }
+  }};
+
+  for (int i {0}; i < 200; ++i) {
+    std::istringstream stream {logger.dumpFlightRecorder()};
+    for (std::string line; std::getline(stream, line);) {
+      EXPECT_TRUE(testRegex(line, R"(\[.+\] VERBOSE: \[\d+\] Record (\d+) x*)"));
+      const auto number {std::stoi(line.substr(line.find("Record ") + 7))};
+      EXPECT_EQ(line.size() - line.find("Record "), 8 + std::to_string(number).size() + number % 300);
+    }
+  }
+  stop = true;
+  thread.join();
+}
+
+TEST_S(FlightRecorder, MultipleThreads) {
+  auto &logger {display_device::Logger::get()};
+  logger.setLogLevel(display_device::Logger::LogLevel::fatal);
+  logger.enableFlightRecorder(4);
+
+  // The threads are kept alive until all of them are done, otherwise the rings would be reused
+  std::latch done {4};
+  std::vector<std::thread> threads;
+  for (int i {0}; i < 4; ++i) {
+    threads.emplace_back([i, &done]() {
+      for (int j {0}; j < 100; ++j) {
+        DD_LOG(verbose) << "Thread " << i << " record " << j;
+      }
+      done.arrive_and_wait();
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  // The records of the exited threads are kept
+  const auto dump {logger.dumpFlightRecorder()};
+  for (int i {0}; i < 4; ++i) {
+    EXPECT_NE(dump.find("Thread " + std::to_string(i) + " record 99\n"), std::string::npos);
+    EXPECT_EQ(dump.find("Thread " + std::to_string(i) + " record 95\n"), std::string::npos);
+  }
+}
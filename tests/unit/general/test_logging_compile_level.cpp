@@ -0,0 +1,75 @@
+// local includes
+#include "display_device/logging.h"
+#include "fixtures/fixtures.h"
+
+// Everything below the warning level is compiled out in this file
+#undef DD_LOG_COMPILE_LEVEL
+#define DD_LOG_COMPILE_LEVEL 3
+
+namespace {
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, LoggingCompileLevelTest, __VA_ARGS__)
+}  // namespace
+
+TEST_S(StatementsBelowFloorAreDiscarded) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  std::vector<level> output;
+  logger.setLogLevel(level::verbose);
+  logger.setCustomCallback([&output](const level level, auto) {
+    output.push_back(level);
+  });
+
+  int evaluated_count {0};
+  const auto some_function {[&evaluated_count]() {
+    ++evaluated_count;
+    return "some string";
+  }};
+
+  DD_LOG(verbose) << some_function();
+  DD_LOG(debug) << some_function();
+  DD_LOG(info) << some_function();
+  EXPECT_EQ(evaluated_count, 0);
+  EXPECT_TRUE(output.empty());
+
+  DD_LOG(warning) << some_function();
+  DD_LOG(error) << some_function();
+  DD_LOG(fatal) << some_function();
+  EXPECT_EQ(evaluated_count, 3);
+  EXPECT_EQ(output, (std::vector<level> {level::warning, level::error, level::fatal}));
+}
+
+TEST_S(StatementsAboveFloorRespectRuntimeLevel) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+
+  int evaluated_count {0};
+  const auto some_function {[&evaluated_count]() {
+    ++evaluated_count;
+    return "some string";
+  }};
+
+  logger.setLogLevel(level::error);
+  logger.setCustomCallback([](auto, auto) {});
+
+  DD_LOG(warning) << some_function();
+  EXPECT_EQ(evaluated_count, 0);
+
+  DD_LOG(error) << some_function();
+  EXPECT_EQ(evaluated_count, 1);
+}
+
+TEST_S(DanglingElse) {
+  bool else_branch_taken {false};
+  const bool condition {false};
+
+  // clang-format off
+  if (condition)
+    DD_LOG(info) << "Hello World!";
+  else
+    else_branch_taken = true;
+  // clang-format on
+
+  EXPECT_TRUE(else_branch_taken);
+}
@@ -0,0 +1,179 @@
+// system includes
+#include <fstream>
+#include <gmock/gmock.h>
+#include <thread>
+#include <vector>
+
+// local includes
+#include "display_device/mapped_file_sink.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords for GMock
+  using ::testing::HasSubstr;
+
+  // Test fixture(s) for this file
+  class MappedFileSinkTest: public BaseTest {
+  public:
+    ~MappedFileSinkTest() override {
+      removeFiles();
+    }
+
+    void removeFiles() const {
+      std::filesystem::remove(m_filepath);
+      for (int i {1}; i <= 100; ++i) {
+        std::filesystem::remove(getBackupPath(i));
+      }
+    }
+
+    [[nodiscard]] std::filesystem::path getBackupPath(const int index) const {
+      return m_filepath.string() + "." + std::to_string(index);
+    }
+
+    [[nodiscard]] static std::vector<std::string> readLines(const std::filesystem::path &filepath) {
+      std::ifstream stream {filepath, std::ios::binary};
+      std::vector<std::string> lines;
+      for (std::string line; std::getline(stream, line);) {
+        lines.push_back(line);
+      }
+      return lines;
+    }
+
+    std::filesystem::path m_filepath {"mapped_file_sink.log"};
+  };
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_F_S(...) DD_MAKE_TEST(TEST_F, MappedFileSinkTest, __VA_ARGS__)
+}  // namespace
+
+TEST_F_S(EmptyFilenameProvided) {
+  EXPECT_THAT([]() {
+    const display_device::MappedFileSink sink(std::filesystem::path {}, 1024, 1);
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Empty filename provided for MappedFileSink!")));
+}
+
+TEST_F_S(ZeroFileSizeProvided) {
+  EXPECT_THAT([this]() {
+    const display_device::MappedFileSink sink(m_filepath, 0, 1);
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Invalid maximum file size provided for MappedFileSink!")));
+}
+
+TEST_F_S(Write) {
+  using level = display_device::Logger::LogLevel;
+  {
+    display_device::MappedFileSink sink {m_filepath, 1024, 1};
+    sink.write(level::info, "Hello");
+    sink.write(level::error, "World!");
+    EXPECT_TRUE(sink.sync());
+  }
+
+  const auto lines {readLines(m_filepath)};
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_TRUE(testRegex(lines[0], R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] INFO:    Hello)"));
+  EXPECT_TRUE(testRegex(lines[1], R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] ERROR:   World!)"));
+  EXPECT_FALSE(std::filesystem::exists(getBackupPath(1)));
+}
+
+TEST_F_S(ExistingFileIsRotated) {
+  using level = display_device::Logger::LogLevel;
+  {
+    std::ofstream stream {m_filepath};
+    stream << "Previous run\n";
+  }
+
+  {
+    display_device::MappedFileSink sink {m_filepath, 1024, 1};
+    sink.write(level::info, "Current run");
+  }
+
+  EXPECT_EQ(readLines(getBackupPath(1)), std::vector<std::string> {"Previous run"});
+  EXPECT_EQ(readLines(m_filepath).size(), 1);
+}
+
+TEST_F_S(Rotation) {
+  using level = display_device::Logger::LogLevel;
+  constexpr std::size_t max_file_size {256};
+  {
+    display_device::MappedFileSink sink {m_filepath, max_file_size, 2};
+    for (int i {0}; i < 100; ++i) {
+      sink.write(level::info, "Line " + std::to_string(i));
+    }
+  }
+
+  EXPECT_TRUE(std::filesystem::exists(getBackupPath(1)));
+  EXPECT_TRUE(std::filesystem::exists(getBackupPath(2)));
+  EXPECT_FALSE(std::filesystem::exists(getBackupPath(3)));
+  for (const auto &filepath : {m_filepath, getBackupPath(1), getBackupPath(2)}) {
+    EXPECT_LE(std::filesystem::file_size(filepath), max_file_size);
+  }
+
+  // The newest lines are in the current file, while older ones are shifted to the backups
+  const auto lines {readLines(m_filepath)};
+  ASSERT_FALSE(lines.empty());
+  EXPECT_THAT(lines.back(), HasSubstr("Line 99"));
+  const auto backup_lines {readLines(getBackupPath(1))};
+  ASSERT_FALSE(backup_lines.empty());
+  EXPECT_THAT(backup_lines.back(), HasSubstr("Line " + std::to_string(99 - static_cast<int>(lines.size()))));
+}
+
+TEST_F_S(LongLineIsTruncated) {
+  using level = display_device::Logger::LogLevel;
+  {
+    display_device::MappedFileSink sink {m_filepath, 64, 1};
+    sink.write(level::info, std::string(128, 'x'));
+  }
+
+  EXPECT_EQ(std::filesystem::file_size(m_filepath), 64);
+}
+
+TEST_F_S(MultipleWriters) {
+  using level = display_device::Logger::LogLevel;
+  constexpr int thread_count {4};
+  constexpr int lines_per_thread {1000};
+  {
+    display_device::MappedFileSink sink {m_filepath, 16 * 1024, 100};
+
+    std::vector<std::thread> threads;
+    for (int i {0}; i < thread_count; ++i) {
+      threads.emplace_back([&sink, i]() {
+        for (int j {0}; j < lines_per_thread; ++j) {
+          sink.write(level::info, std::to_string(i) + ":" + std::to_string(j));
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  std::size_t line_count {readLines(m_filepath).size()};
+  for (int i {1}; std::filesystem::exists(getBackupPath(i)); ++i) {
+    const auto lines {readLines(getBackupPath(i))};
+    for (const auto &line : lines) {
+      EXPECT_TRUE(testRegex(line, R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] INFO:    \d:\d+)"));
+    }
+    line_count += lines.size();
+  }
+  EXPECT_EQ(line_count, thread_count * lines_per_thread);
+}
+
+TEST_F_S(AsLoggerSink) {
+  using level = display_device::Logger::LogLevel;
+  auto &logger {display_device::Logger::get()};
+  {
+    auto sink {std::make_shared<display_device::MappedFileSink>(m_filepath, 1024, 1)};
+    logger.addSink(level::warning, [sink](const level log_level, const std::string &value) {
+      sink->write(log_level, value);
+    });
+
+    DD_LOG(info) << "Filtered";
+    DD_LOG(warning) << "Written";
+    logger.removeAllSinks();
+  }
+
+  const auto lines {readLines(m_filepath)};
+  ASSERT_EQ(lines.size(), 1);
+  EXPECT_THAT(lines[0], HasSubstr("WARNING: Written"));
+}
@@ -0,0 +1,29 @@
+// local includes
+#include "display_device/pnp_vendor.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, PnpVendor, __VA_ARGS__)
+}  // namespace
+
+TEST_S(KnownVendors) {
+  EXPECT_EQ(display_device::getPnpVendorName("ACI"), "ASUSTeK Computer Inc.");
+  EXPECT_EQ(display_device::getPnpVendorName("DEL"), "Dell Inc.");
+  EXPECT_EQ(display_device::getPnpVendorName("GSM"), "LG Electronics");
+  EXPECT_EQ(display_device::getPnpVendorName("WAC"), "Wacom Tech");
+  EXPECT_EQ(display_device::getPnpVendorName(ut_consts::DEFAULT_EDID_DATA.m_manufacturer_id.view()), "ASUSTeK Computer Inc.");
+}
+
+TEST_S(UnknownVendors) {
+  EXPECT_EQ(display_device::getPnpVendorName("ZZZ"), "");
+  EXPECT_EQ(display_device::getPnpVendorName("AAA"), "");
+}
+
+TEST_S(InvalidIds) {
+  EXPECT_EQ(display_device::getPnpVendorName(""), "");
+  EXPECT_EQ(display_device::getPnpVendorName("AC"), "");
+  EXPECT_EQ(display_device::getPnpVendorName("ACIA"), "");
+  EXPECT_EQ(display_device::getPnpVendorName("aci"), "");
+  EXPECT_EQ(display_device::getPnpVendorName("A@I"), "");
+}
@@ -1,4 +1,8 @@
 // system includes
+#include <atomic>
+#include <coroutine>
+#include <deque>
+#include <future>
 #include <gmock/gmock.h>
 
 // local includes
@@ -26,6 +30,95 @@ namespace {
     return static_cast<int>(std::round(value * 0.99));
   }
 
+  // A fire-and-forget coroutine for testing the awaitables
+  struct TestCoroutine {
+    struct promise_type {
+      TestCoroutine get_return_object() {
+        return {};
+      }
+
+      std::suspend_never initial_suspend() noexcept {
+        return {};
+      }
+
+      std::suspend_never final_suspend() noexcept {
+        return {};
+      }
+
+      void return_void() { /* noop */ }
+
+      void unhandled_exception() {
+        std::terminate();
+      }
+    };
+  };
+
+  // A coroutine that is owned by the caller, so that it can be destroyed while suspended
+  struct OwnedTestCoroutine {
+    struct promise_type {
+      OwnedTestCoroutine get_return_object() {
+        return OwnedTestCoroutine {std::coroutine_handle<promise_type>::from_promise(*this)};
+      }
+
+      std::suspend_never initial_suspend() noexcept {
+        return {};
+      }
+
+      std::suspend_always final_suspend() noexcept {
+        return {};
+      }
+
+      void return_void() { /* noop */ }
+
+      void unhandled_exception() {
+        std::terminate();
+      }
+    };
+
+    explicit OwnedTestCoroutine(const std::coroutine_handle<promise_type> handle):
+        m_handle {handle} {
+    }
+
+    OwnedTestCoroutine(const OwnedTestCoroutine &) = delete;
+    OwnedTestCoroutine &operator=(const OwnedTestCoroutine &) = delete;
+
+    ~OwnedTestCoroutine() {
+      m_handle.destroy();
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+  };
+
+  // A minimal event loop acting as the caller's executor
+  class TestEventLoop {
+  public:
+    display_device::SchedulerExecutor getExecutor() {
+      return [this](std::function<void()> fn) {
+        std::lock_guard lock {m_mutex};
+        m_queue.push_back(std::move(fn));
+        m_cv.notify_one();
+      };
+    }
+
+    void runUntil(const std::function<bool()> &predicate) {
+      while (!predicate()) {
+        std::unique_lock lock {m_mutex};
+        m_cv.wait(lock, [this]() {
+          return !m_queue.empty();
+        });
+        auto fn {std::move(m_queue.front())};
+        m_queue.pop_front();
+        lock.unlock();
+        fn();
+      }
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::function<void()>> m_queue;
+  };
+
   // Test fixture(s) for this file
   class RetrySchedulerTest: public BaseTest {
   public:
@@ -68,6 +161,45 @@ TEST_F_S(Schedule, ZeroDuration) {
               ThrowsMessage<std::logic_error>(HasSubstr("All of the durations specified in RetryScheduler::schedule must be larger than a 0!")));
 }
 
+TEST_F_S(Schedule, BothDurationsAndPolicy) {
+  EXPECT_THAT([&]() {
+    m_impl.schedule([](auto, auto &) {
+    },
+                    {.m_sleep_durations = {1ms}, .m_backoff_policy = display_device::ConstantBackoff {.m_duration = 1ms}});
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Both the sleep durations and the backoff policy are specified in RetryScheduler::schedule!")));
+}
+
+TEST_F_S(Schedule, InvalidBackoffPolicy) {
+  EXPECT_THAT([&]() {
+    m_impl.schedule([](auto, auto &) {
+    },
+                    {.m_backoff_policy = display_device::ConstantBackoff {.m_duration = 0ms}});
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Invalid backoff policy specified in RetryScheduler::schedule!")));
+}
+
+TEST_F_S(Schedule, BackoffPolicy) {
+  std::vector<std::chrono::steady_clock::time_point> calls;
+  m_impl.schedule([&calls](auto, auto &stop_token) {
+    calls.push_back(std::chrono::steady_clock::now());
+    if (calls.size() == 5) {
+      stop_token.requestStop();
+    }
+  },
+                  {.m_backoff_policy = display_device::ExponentialBackoff {.m_initial = 5ms, .m_multiplier = 2.0, .m_max = 20ms}});
+
+  while (m_impl.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  const std::vector expected_delays {5, 10, 20, 20};
+  ASSERT_EQ(calls.size(), expected_delays.size() + 1);
+  for (std::size_t i {0}; i < expected_delays.size(); ++i) {
+    EXPECT_GE(std::chrono::duration_cast<std::chrono::milliseconds>(calls[i + 1] - calls[i]).count(), roundTo99(expected_delays[i]));
+  }
+}
+
 TEST_F_S(Schedule, SchedulingDurations) {
   // Note: in this test we care that the delay is not less than the requested one, but we
   //       do not really have an upper ceiling...
@@ -614,6 +746,625 @@ TEST_F_S(Stop) {
   EXPECT_FALSE(m_impl.isScheduled());
 }
 
+TEST_F_S(NamedTasks, RunIndependently) {
+  std::atomic<int> counter_fast {0};
+  std::atomic<int> counter_slow {0};
+  m_impl.schedule("fast", [&](auto, auto &) {
+    counter_fast++;
+  },
+                  {.m_sleep_durations = {1ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+  m_impl.schedule("slow", [&](auto, auto &) {
+    counter_slow++;
+  },
+                  {.m_sleep_durations = {50ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+
+  EXPECT_TRUE(m_impl.isScheduled("fast"));
+  EXPECT_TRUE(m_impl.isScheduled("slow"));
+  EXPECT_FALSE(m_impl.isScheduled("other"));
+
+  while (counter_slow < 2) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_GT(counter_fast, counter_slow);
+
+  m_impl.stop();
+  EXPECT_FALSE(m_impl.isScheduled());
+  EXPECT_FALSE(m_impl.isScheduled("fast"));
+  EXPECT_FALSE(m_impl.isScheduled("slow"));
+}
+
+TEST_F_S(NamedTasks, StopOnlyAffectsTheTask) {
+  std::atomic<int> counter_a {0};
+  std::atomic<int> counter_b {0};
+  m_impl.schedule("a", [&](auto, auto &stop_token) {
+    if (++counter_a == 3) {
+      stop_token.requestStop();
+    }
+  },
+                  {.m_sleep_durations = {1ms}});
+  m_impl.schedule("b", [&](auto, auto &) {
+    counter_b++;
+  },
+                  {.m_sleep_durations = {1ms}});
+  m_impl.schedule([](auto, auto &) {}, {.m_sleep_durations = {1ms}});
+
+  while (m_impl.isScheduled("a")) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(counter_a, 3);
+  EXPECT_TRUE(m_impl.isScheduled("b"));
+
+  m_impl.stop("b");
+  EXPECT_FALSE(m_impl.isScheduled("b"));
+  EXPECT_TRUE(m_impl.isScheduled(""));
+  EXPECT_TRUE(m_impl.isScheduled());
+
+  const int counter_b_after_stop {counter_b};
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(counter_b, counter_b_after_stop);
+
+  m_impl.stop();
+}
+
+TEST_F_S(NamedTasks, ReplacedByName) {
+  std::atomic<int> counter_a {0};
+  std::atomic<int> counter_b {0};
+  m_impl.schedule("task", [&](auto, auto &) {
+    counter_a++;
+  },
+                  {.m_sleep_durations = {1ms}});
+  while (counter_a < 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  m_impl.schedule("task", [&](auto, auto &) {
+    counter_b++;
+  },
+                  {.m_sleep_durations = {1ms}});
+  const int counter_a_after_replace {counter_a};
+  while (counter_b < 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(counter_a, counter_a_after_replace);
+  m_impl.stop();
+}
+
+TEST_F_S(NamedTasks, ExceptionOnlyStopsTheTask) {
+  std::atomic<int> counter {0};
+  m_impl.schedule("throwing", [&](auto, auto &) {
+    throw std::runtime_error("Get rekt!");
+  },
+                  {.m_sleep_durations = {1ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+  m_impl.schedule("counting", [&](auto, auto &) {
+    counter++;
+  },
+                  {.m_sleep_durations = {1ms}});
+
+  while (m_impl.isScheduled("throwing")) {
+    std::this_thread::sleep_for(1ms);
+  }
+  const int counter_after_exception {counter};
+  while (counter <= counter_after_exception) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_TRUE(m_impl.isScheduled("counting"));
+
+  m_impl.stop();
+}
+
+TEST_F_S(SharedTimerService, RunIndependently) {
+  const auto timer_service {std::make_shared<display_device::SchedulerTimerService>()};
+  display_device::RetryScheduler<TestIface> scheduler_a {std::make_unique<TestIface>(), timer_service};
+  display_device::RetryScheduler<TestIface> scheduler_b {std::make_unique<TestIface>(), timer_service};
+
+  std::atomic<int> counter_a {0};
+  std::atomic<int> counter_b {0};
+  scheduler_a.schedule([&](auto, auto &stop_token) {
+    if (++counter_a == 3) {
+      stop_token.requestStop();
+    }
+  },
+                       {.m_sleep_durations = {1ms}});
+  scheduler_b.schedule([&](auto, auto &) {
+    counter_b++;
+  },
+                       {.m_sleep_durations = {1ms}});
+
+  while (scheduler_a.isScheduled() || counter_b < 5) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(counter_a, 3);
+  EXPECT_TRUE(scheduler_b.isScheduled());
+
+  scheduler_b.stop();
+  const int counter_b_after_stop {counter_b};
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(counter_b, counter_b_after_stop);
+}
+
+TEST_F_S(SharedTimerService, SerializedWithExecute) {
+  const auto timer_service {std::make_shared<display_device::SchedulerTimerService>()};
+  display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>(), timer_service};
+
+  bool in_task {false};
+  std::atomic<int> counter {0};
+  scheduler.schedule([&](auto, auto &) {
+    in_task = true;
+    std::this_thread::sleep_for(1ms);
+    counter++;
+    in_task = false;
+  },
+                     {.m_sleep_durations = {1ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+
+  while (counter < 5) {
+    EXPECT_FALSE(scheduler.execute([&](auto &) {
+      return in_task;
+    }));
+  }
+  scheduler.stop();
+}
+
+TEST_F_S(SharedTimerService, CleanupInDestructor) {
+  const auto timer_service {std::make_shared<display_device::SchedulerTimerService>()};
+  display_device::RetryScheduler<TestIface> other_scheduler {std::make_unique<TestIface>(), timer_service};
+
+  std::atomic<int> counter {0};
+  std::atomic<int> other_counter {0};
+  other_scheduler.schedule([&](auto, auto &) {
+    other_counter++;
+  },
+                           {.m_sleep_durations = {1ms}});
+  {
+    display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>(), timer_service};
+    scheduler.schedule([&](auto, auto &) {
+      std::this_thread::sleep_for(1ms);
+      counter++;
+    },
+                       {.m_sleep_durations = {1ms}});
+    while (counter < 3) {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+
+  const int counter_before_sleep {counter};
+  const int other_counter_before_sleep {other_counter};
+  std::this_thread::sleep_for(100ms);
+
+  EXPECT_EQ(counter, counter_before_sleep);
+  EXPECT_GT(other_counter, other_counter_before_sleep);
+}
+
+TEST_F_S(ExecuteAsync, EmptyArgumentsProvided) {
+  EXPECT_THAT([&]() {
+    std::ignore = m_impl.executeAsync(std::function<void(TestIface &)> {}, [](auto) {});
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Empty callback function provided in RetryScheduler::executeAsync!")));
+  EXPECT_THAT([&]() {
+    std::ignore = m_impl.executeAsync([](auto &) {}, nullptr);
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Empty executor provided in RetryScheduler::executeAsync!")));
+}
+
+TEST_F_S(ExecuteAsync, ResumesOnExecutor) {
+  TestEventLoop loop;
+  const auto caller_thread_id {std::this_thread::get_id()};
+  std::thread::id exec_thread_id;
+  std::thread::id resumed_thread_id;
+  std::optional<int> result;
+
+  // The closure must outlive the coroutine as it is referenced by the coroutine frame
+  const auto coroutine {[&]() -> TestCoroutine {
+    result = co_await m_impl.executeAsync([&](TestIface &) {
+      exec_thread_id = std::this_thread::get_id();
+      return 42;
+    },
+                                          loop.getExecutor());
+    resumed_thread_id = std::this_thread::get_id();
+  }};
+  coroutine();
+  loop.runUntil([&]() {
+    return result.has_value();
+  });
+
+  EXPECT_EQ(*result, 42);
+  EXPECT_NE(exec_thread_id, caller_thread_id);
+  EXPECT_EQ(resumed_thread_id, caller_thread_id);
+}
+
+TEST_F_S(ExecuteAsync, ExceptionThrown) {
+  TestEventLoop loop;
+  std::optional<std::string> error_message;
+
+  const auto coroutine {[&]() -> TestCoroutine {
+    try {
+      co_await m_impl.executeAsync([&](TestIface &) {
+        throw std::runtime_error("Get rekt!");
+      },
+                                   loop.getExecutor());
+    } catch (const std::exception &error) {
+      error_message = error.what();
+    }
+  }};
+  coroutine();
+  loop.runUntil([&]() {
+    return error_message.has_value();
+  });
+
+  EXPECT_EQ(*error_message, "Get rekt!");
+}
+
+TEST_F_S(ExecuteAsync, NotBlockedByRunningTask) {
+  TestEventLoop loop;
+  std::atomic<bool> task_started {false};
+  std::atomic<bool> release_task {false};
+  std::vector<std::string> order;
+
+  m_impl.schedule([&](auto, auto &stop_token) {
+    task_started = true;
+    while (!release_task) {
+      std::this_thread::sleep_for(1ms);
+    }
+    order.emplace_back("task");
+    stop_token.requestStop();
+  },
+                  {.m_sleep_durations = {1ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+  while (!task_started) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  // The task is holding the interface right now, but awaiting must not block the caller
+  bool done {false};
+  const auto coroutine {[&]() -> TestCoroutine {
+    co_await m_impl.executeAsync([&](TestIface &) {
+      order.emplace_back("call");
+    },
+                                 loop.getExecutor());
+    done = true;
+  }};
+  coroutine();
+  order.emplace_back("caller");
+  release_task = true;
+  loop.runUntil([&]() {
+    return done;
+  });
+
+  EXPECT_EQ(order, (std::vector<std::string> {"caller", "task", "call"}));
+}
+
+TEST_F_S(ExecuteAsync, CoroutineDestroyedWhileSuspended) {
+  TestEventLoop loop;
+  std::atomic<bool> task_started {false};
+  std::atomic<bool> release_task {false};
+
+  m_impl.schedule([&](auto, auto &stop_token) {
+    task_started = true;
+    while (!release_task) {
+      std::this_thread::sleep_for(1ms);
+    }
+    stop_token.requestStop();
+  },
+                  {.m_sleep_durations = {1ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+  while (!task_started) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  bool executed {false};
+  bool resumed {false};
+  const auto coroutine_fn {[&]() -> OwnedTestCoroutine {
+    co_await m_impl.executeAsync([&](TestIface &) {
+      executed = true;
+    },
+                                 loop.getExecutor());
+    resumed = true;
+  }};
+  {
+    // Destroyed while awaiting the queued call
+    const auto coroutine {coroutine_fn()};
+  }
+  release_task = true;
+
+  // The queued calls are executed in order, so the cancelled one is already processed after this
+  m_impl.executeAsync([](auto &) {}).wait();
+  EXPECT_FALSE(executed);
+  EXPECT_FALSE(resumed);
+}
+
+TEST_F_S(ExecuteAsync, SharedTimerService) {
+  TestEventLoop loop;
+  const auto timer_service {std::make_shared<display_device::SchedulerTimerService>()};
+  display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>(), timer_service};
+  std::optional<int> result;
+
+  const auto coroutine {[&]() -> TestCoroutine {
+    result = co_await scheduler.executeAsync([&](TestIface &) {
+      return 42;
+    },
+                                             loop.getExecutor());
+  }};
+  coroutine();
+  loop.runUntil([&]() {
+    return result.has_value();
+  });
+
+  EXPECT_EQ(*result, 42);
+}
+
+TEST_F_S(ExecuteAsync, Future, NullptrCallbackProvided) {
+  EXPECT_THAT([&]() {
+    std::ignore = m_impl.executeAsync(std::function<void(TestIface &)> {});
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Empty callback function provided in RetryScheduler::executeAsync!")));
+}
+
+TEST_F_S(ExecuteAsync, Future, Pipelined) {
+  const auto caller_thread_id {std::this_thread::get_id()};
+  std::vector<int> order;
+
+  auto future_a {m_impl.executeAsync([&](TestIface &) {
+    order.push_back(1);
+    return std::this_thread::get_id();
+  })};
+  auto future_b {m_impl.executeAsync([&](TestIface &) {
+    order.push_back(2);
+    return std::string {"result"};
+  })};
+  auto future_c {m_impl.executeAsync([&](TestIface &) {
+    order.push_back(3);
+  })};
+
+  EXPECT_NE(future_a.get(), caller_thread_id);
+  EXPECT_EQ(future_b.get(), "result");
+  future_c.get();
+  EXPECT_EQ(order, (std::vector<int> {1, 2, 3}));
+}
+
+TEST_F_S(ExecuteAsync, Future, SerializedWithTasks) {
+  bool in_task {false};
+  std::atomic<int> counter {0};
+  m_impl.schedule([&](auto, auto &) {
+    in_task = true;
+    std::this_thread::sleep_for(1ms);
+    counter++;
+    in_task = false;
+  },
+                  {.m_sleep_durations = {1ms}, .m_execution = display_device::SchedulerOptions::Execution::ScheduledOnly});
+
+  while (counter < 3) {
+    auto future {m_impl.executeAsync([&](auto &) {
+      return in_task;
+    })};
+    EXPECT_FALSE(future.get());
+  }
+
+  auto stop_future {m_impl.executeAsync([](auto &, auto &stop_token) {
+    stop_token.requestStop();
+  })};
+  stop_future.get();
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(ExecuteAsync, Future, ExceptionThrown) {
+  auto future {m_impl.executeAsync([](auto &) {
+    throw std::runtime_error("Get rekt!");
+  })};
+
+  EXPECT_THAT([&]() {
+    future.get();
+  },
+              ThrowsMessage<std::runtime_error>(HasSubstr("Get rekt!")));
+}
+
+TEST_F_S(ExecuteAsync, Future, ExecutedBeforeDestruction) {
+  std::future<int> future;
+  {
+    display_device::RetryScheduler<TestIface> scheduler {std::make_unique<TestIface>()};
+    future = scheduler.executeAsync([](auto &) {
+      std::this_thread::sleep_for(1ms);
+      return 42;
+    });
+  }
+
+  EXPECT_EQ(future.get(), 42);
+}
+
+TEST_F_S(RetryUntil, EmptyArgumentsProvided) {
+  EXPECT_THAT([&]() {
+    std::ignore = m_impl.retryUntil(nullptr, display_device::ConstantBackoff {1ms}, [](auto) {});
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Empty callback function provided in RetryScheduler::retryUntil!")));
+  EXPECT_THAT([&]() {
+    std::ignore = m_impl.retryUntil([](auto &) {
+      return true;
+    },
+                                    display_device::ConstantBackoff {0ms},
+                                    [](auto) {});
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Invalid backoff policy specified in RetryScheduler::retryUntil!")));
+  EXPECT_THAT([&]() {
+    std::ignore = m_impl.retryUntil([](auto &) {
+      return true;
+    },
+                                    display_device::ConstantBackoff {1ms},
+                                    nullptr);
+  },
+              ThrowsMessage<std::logic_error>(HasSubstr("Empty executor provided in RetryScheduler::retryUntil!")));
+}
+
+TEST_F_S(RetryUntil, Succeeded) {
+  TestEventLoop loop;
+  const auto caller_thread_id {std::this_thread::get_id()};
+  std::thread::id resumed_thread_id;
+  int counter {0};
+  std::optional<bool> result;
+
+  const auto coroutine {[&]() -> TestCoroutine {
+    result = co_await m_impl.retryUntil([&](TestIface &) {
+      return ++counter == 3;
+    },
+                                        display_device::ConstantBackoff {1ms},
+                                        loop.getExecutor());
+    resumed_thread_id = std::this_thread::get_id();
+  }};
+  coroutine();
+  loop.runUntil([&]() {
+    return result.has_value();
+  });
+
+  EXPECT_TRUE(*result);
+  EXPECT_EQ(counter, 3);
+  EXPECT_EQ(resumed_thread_id, caller_thread_id);
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
+TEST_F_S(RetryUntil, Stopped) {
+  TestEventLoop loop;
+  std::atomic<int> counter {0};
+  std::optional<bool> result;
+
+  const auto coroutine {[&]() -> TestCoroutine {
+    result = co_await m_impl.retryUntil([&](TestIface &) {
+      counter++;
+      return false;
+    },
+                                        display_device::ConstantBackoff {1ms},
+                                        loop.getExecutor());
+  }};
+  coroutine();
+  while (counter < 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+  m_impl.stop();
+  loop.runUntil([&]() {
+    return result.has_value();
+  });
+
+  EXPECT_FALSE(*result);
+}
+
+TEST_F_S(RetryUntil, StoppedByName) {
+  TestEventLoop loop;
+  std::atomic<int> counter {0};
+  std::optional<bool> result;
+
+  m_impl.schedule("other", [](auto, auto &) {}, {.m_sleep_durations = {1ms}});
+  const auto coroutine {[&]() -> TestCoroutine {
+    result = co_await m_impl.retryUntil("revert", [&](TestIface &) {
+      counter++;
+      return false;
+    },
+                                        display_device::ConstantBackoff {1ms},
+                                        loop.getExecutor());
+  }};
+  coroutine();
+  while (counter < 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+  m_impl.stop("revert");
+  loop.runUntil([&]() {
+    return result.has_value();
+  });
+
+  EXPECT_FALSE(*result);
+  EXPECT_TRUE(m_impl.isScheduled("other"));
+}
+
+TEST_F_S(RetryUntil, StoppedByTaskName) {
+  TestEventLoop loop;
+  std::atomic<int> counter {0};
+  std::string task_name;
+  std::optional<bool> result;
+
+  const auto coroutine {[&]() -> TestCoroutine {
+    auto retry {m_impl.retryUntil([&](TestIface &) {
+      counter++;
+      return false;
+    },
+                                  display_device::ConstantBackoff {1ms},
+                                  loop.getExecutor())};
+    task_name = retry.getTaskName();
+    result = co_await retry;
+  }};
+  coroutine();
+  while (counter < 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_THAT(task_name, HasSubstr("retryUntil#"));
+  EXPECT_TRUE(m_impl.isScheduled(task_name));
+  m_impl.stop(task_name);
+  loop.runUntil([&]() {
+    return result.has_value();
+  });
+
+  EXPECT_FALSE(*result);
+}
+
+TEST_F_S(RetryUntil, CoroutineDestroyedWhileSuspended) {
+  TestEventLoop loop;
+  std::atomic<int> counter {0};
+  bool resumed {false};
+
+  const auto coroutine_fn {[&]() -> OwnedTestCoroutine {
+    co_await m_impl.retryUntil([&](TestIface &) {
+      counter++;
+      return false;
+    },
+                               display_device::ConstantBackoff {1ms},
+                               loop.getExecutor());
+    resumed = true;
+  }};
+  {
+    // Destroyed while awaiting the retries
+    const auto coroutine {coroutine_fn()};
+    while (counter < 3) {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+
+  // The task stops itself before the next attempt
+  while (m_impl.isScheduled()) {
+    std::this_thread::sleep_for(1ms);
+  }
+  const int final_counter {counter};
+  std::this_thread::sleep_for(10ms);
+  EXPECT_EQ(counter, final_counter);
+
+  // The completion does not post the resumption of the destroyed coroutine
+  bool loop_drained {false};
+  loop.getExecutor()([&loop_drained]() {
+    loop_drained = true;
+  });
+  loop.runUntil([&]() {
+    return loop_drained;
+  });
+  EXPECT_FALSE(resumed);
+}
+
+TEST_F_S(RetryUntil, ExceptionThrown) {
+  TestEventLoop loop;
+  std::optional<std::string> error_message;
+
+  const auto coroutine {[&]() -> TestCoroutine {
+    try {
+      co_await m_impl.retryUntil([&](TestIface &) -> bool {
+        throw std::runtime_error("Get rekt!");
+      },
+                                 display_device::ConstantBackoff {1ms},
+                                 loop.getExecutor());
+    } catch (const std::exception &error) {
+      error_message = error.what();
+    }
+  }};
+  coroutine();
+  loop.runUntil([&]() {
+    return error_message.has_value();
+  });
+
+  EXPECT_EQ(*error_message, "Get rekt!");
+  EXPECT_FALSE(m_impl.isScheduled());
+}
+
 TEST_F_S(ThreadCleanupInDestructor) {
   int counter {0};
   {
@@ -0,0 +1,53 @@
+#if !defined(_MSC_VER) && !defined(_POSIX_THREAD_SAFE_FUNCTIONS)
+  #define _POSIX_THREAD_SAFE_FUNCTIONS  // For localtime_r
+#endif
+
+// system includes
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+
+// local includes
+#include "display_device/detail/timestamp_formatter.h"
+#include "fixtures/fixtures.h"
+
+namespace {
+  // Convenience keywords
+  using namespace std::chrono_literals;
+
+  /**
+   * @brief The straightforward (slow) way of formatting the timestamp.
+   */
+  std::string formatReference(const std::chrono::system_clock::time_point time) {
+    const auto time_t {std::chrono::system_clock::to_time_t(std::chrono::floor<std::chrono::seconds>(time))};
+    std::tm localtime {};
+#if defined(_MSC_VER)
+    localtime_s(&localtime, &time_t);
+#else
+    localtime_r(&time_t, &localtime);
+#endif
+
+    const auto milliseconds {std::chrono::duration_cast<std::chrono::milliseconds>(time - std::chrono::floor<std::chrono::seconds>(time))};
+    std::stringstream stream;
+    stream << std::put_time(&localtime, "[%Y-%m-%d %H:%M:%S.") << std::setfill('0') << std::setw(3) << milliseconds.count() << "] ";
+    return stream.str();
+  }
+
+  // Specialized TEST macro(s) for this test file
+#define TEST_S(...) DD_MAKE_TEST(TEST, TimestampFormatter, __VA_ARGS__)
+}  // namespace
+
+TEST_S(MatchesReferenceFormat) {
+  const std::chrono::system_clock::time_point base_time {std::chrono::system_clock::now()};
+
+  display_device::detail::TimestampBuffer buffer;
+  for (const auto offset : {0ms, 1ms, 10ms, 999ms, 1000ms, 1001ms, 59'999ms, 3'600'000ms, 0ms}) {
+    const auto time {base_time + offset};
+    EXPECT_EQ(display_device::detail::formatTimestamp(time, buffer), formatReference(time));
+  }
+}
+
+TEST_S(Format) {
+  display_device::detail::TimestampBuffer buffer;
+  EXPECT_TRUE(testRegex(std::string {display_device::detail::formatTimestamp(std::chrono::system_clock::now(), buffer)}, R"(\[\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}.\d{3}\] )"));
+}